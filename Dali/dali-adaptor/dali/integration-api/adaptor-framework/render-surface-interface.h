@@ -173,6 +173,18 @@ public:
    */
   virtual Integration::StencilBufferAvailable GetStencilBufferRequired() = 0;
 
+  /**
+   * @brief Get the age of the back buffer
+   * @return The buffer age, or 0 if the contents of the back buffer are undefined
+   */
+  virtual int32_t GetBufferAge() = 0;
+
+  /**
+   * @brief Set the area of the surface redrawn in the current frame, to be presented in PostRender
+   * @param[in] damagedRect The damaged area, or an empty rectangle if the whole surface was redrawn
+   */
+  virtual void SetDamagedRect( const Rect<int32_t>& damagedRect ) = 0;
+
 public:
 
   void SetAdaptor( Dali::Internal::Adaptor::AdaptorInternalServices& adaptor )
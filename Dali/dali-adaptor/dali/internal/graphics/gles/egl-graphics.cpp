@@ -30,7 +30,8 @@ namespace Adaptor
 {
 
 EglGraphics::EglGraphics( )
-: mMultiSamplingLevel( 0 )
+: mMultiSamplingLevel( 0 ),
+  mPartialUpdateRequired( false )
 {
 }
 
@@ -65,6 +66,8 @@ void EglGraphics::Initialize( EnvironmentOptions* environmentOptions )
 
   mMultiSamplingLevel = environmentOptions->GetMultiSamplingLevel();
 
+  mPartialUpdateRequired = environmentOptions->PartialUpdateRequired();
+
   mEglSync = Utils::MakeUnique< EglSyncImplementation >();
 
   mEglContextHelper = Utils::MakeUnique< EglContextHelperImplementation >();
@@ -72,7 +75,7 @@ void EglGraphics::Initialize( EnvironmentOptions* environmentOptions )
 
 EglInterface* EglGraphics::Create()
 {
-  mEglImplementation = Utils::MakeUnique< EglImplementation >( mMultiSamplingLevel, mDepthBufferRequired, mStencilBufferRequired );
+  mEglImplementation = Utils::MakeUnique< EglImplementation >( mMultiSamplingLevel, mDepthBufferRequired, mStencilBufferRequired, mPartialUpdateRequired );
   mEglImageExtensions = Utils::MakeUnique< EglImageExtensions >( mEglImplementation.get() );
 
   mEglSync->Initialize( mEglImplementation.get() ); // The sync impl needs the EglDisplay
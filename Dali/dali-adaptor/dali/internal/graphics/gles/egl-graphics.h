@@ -144,6 +144,7 @@ private:
   std::unique_ptr< EglContextHelperImplementation > mEglContextHelper; ///< GlContextHelperAbstraction implementation for EGL
 
   int mMultiSamplingLevel;                                      ///< The multiple sampling level
+  bool mPartialUpdateRequired;                                  ///< Whether partial update is required
 };
 
 } // namespace Adaptor
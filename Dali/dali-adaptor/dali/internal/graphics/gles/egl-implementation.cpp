@@ -36,9 +36,11 @@
 namespace
 {
   const uint32_t THRESHOLD_SWAPBUFFER_COUNT = 5;
-  const uint32_t CHECK_EXTENSION_NUMBER = 2;
+  const uint32_t CHECK_EXTENSION_NUMBER = 4;
   const std::string EGL_KHR_SURFACELESS_CONTEXT = "EGL_KHR_surfaceless_context";
   const std::string EGL_KHR_CREATE_CONTEXT = "EGL_KHR_create_context";
+  const std::string EGL_EXT_BUFFER_AGE = "EGL_EXT_buffer_age";
+  const std::string EGL_KHR_SWAP_BUFFERS_WITH_DAMAGE = "EGL_KHR_swap_buffers_with_damage";
 }
 
 namespace Dali
@@ -63,7 +65,8 @@ namespace Adaptor
 
 EglImplementation::EglImplementation( int multiSamplingLevel,
                                       Integration::DepthBufferAvailable depthBufferRequired,
-                                      Integration::StencilBufferAvailable stencilBufferRequired )
+                                      Integration::StencilBufferAvailable stencilBufferRequired,
+                                      bool partialUpdateRequired )
 : mContextAttribs(),
   mEglNativeDisplay( 0 ),
   mEglNativeWindow( 0 ),
@@ -83,6 +86,9 @@ EglImplementation::EglImplementation( int multiSamplingLevel,
   mStencilBufferRequired( stencilBufferRequired == Integration::StencilBufferAvailable::TRUE ),
   mIsSurfacelessContextSupported( false ),
   mIsKhrCreateContextSupported( false ),
+  mPartialUpdateRequired( partialUpdateRequired ),
+  mIsBufferAgeSupported( false ),
+  mEglSwapBuffersWithDamageKHR( nullptr ),
   mSwapBufferCountAfterResume( 0 )
 {
 }
@@ -136,6 +142,16 @@ bool EglImplementation::InitializeGles( EGLNativeDisplayType display, bool isOwn
       mIsKhrCreateContextSupported = true;
       extensionCheckCount++;
     }
+    if( currentExtension == EGL_EXT_BUFFER_AGE )
+    {
+      mIsBufferAgeSupported = true;
+      extensionCheckCount++;
+    }
+    if( currentExtension == EGL_KHR_SWAP_BUFFERS_WITH_DAMAGE )
+    {
+      mEglSwapBuffersWithDamageKHR = reinterpret_cast< PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC >( eglGetProcAddress( "eglSwapBuffersWithDamageKHR" ) );
+      extensionCheckCount++;
+    }
   }
 
   // We want to display this information all the time, so use the LogMessage directly
@@ -331,6 +347,36 @@ void EglImplementation::SwapBuffers( EGLSurface& eglSurface )
   }
 }
 
+void EglImplementation::SwapBuffers( EGLSurface& eglSurface, const Rect<int>& damagedRect )
+{
+  if( damagedRect.IsEmpty() || !mPartialUpdateRequired || !mEglSwapBuffersWithDamageKHR || ( eglSurface == EGL_NO_SURFACE ) )
+  {
+    SwapBuffers( eglSurface );
+    return;
+  }
+
+  EGLint rect[4] = { damagedRect.x, damagedRect.y, damagedRect.width, damagedRect.height };
+  if( mEglSwapBuffersWithDamageKHR( mEglDisplay, eglSurface, rect, 1 ) == EGL_FALSE )
+  {
+    DALI_LOG_ERROR( "eglSwapBuffersWithDamageKHR failed, swapping the whole surface\n" );
+    Egl::PrintError( eglGetError() );
+    eglSwapBuffers( mEglDisplay, eglSurface );
+  }
+}
+
+EGLint EglImplementation::GetBufferAge( EGLSurface& eglSurface ) const
+{
+  EGLint age = 0;
+  if( mPartialUpdateRequired && mIsBufferAgeSupported && ( eglSurface != EGL_NO_SURFACE ) )
+  {
+    if( eglQuerySurface( mEglDisplay, eglSurface, EGL_BUFFER_AGE_EXT, &age ) == EGL_FALSE )
+    {
+      age = 0;
+    }
+  }
+  return age;
+}
+
 void EglImplementation::CopyBuffers( EGLSurface& eglSurface )
 {
   eglCopyBuffers( mEglDisplay, eglSurface, mCurrentEglNativePixmap );
@@ -23,6 +23,7 @@
 #include <EGL/eglext.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/integration-api/core-enumerations.h>
 
 // INTERNAL INCLUDES
@@ -47,10 +48,12 @@ public:
    * @param[in] multiSamplingLevel The Multi-sampling level required
    * @param[in] depthBufferRequired Whether the depth buffer is required
    * @param[in] stencilBufferRequired Whether the stencil buffer is required
+   * @param[in] partialUpdateRequired Whether partial update is required
    */
   EglImplementation( int multiSamplingLevel,
                      Integration::DepthBufferAvailable depthBufferRequired,
-                     Integration::StencilBufferAvailable stencilBufferRequired );
+                     Integration::StencilBufferAvailable stencilBufferRequired,
+                     bool partialUpdateRequired = false );
 
   /**
    * Destructor
@@ -124,6 +127,20 @@ public:
    */
   virtual void SwapBuffers( EGLSurface& eglSurface );
 
+  /**
+   * Performs an OpenGL swap buffers command, presenting only the damaged area if supported
+   * @param[in] eglSurface The surface to swap
+   * @param[in] damagedRect The damaged area (origin at the bottom-left), or an empty rectangle if the whole surface was redrawn
+   */
+  void SwapBuffers( EGLSurface& eglSurface, const Rect<int>& damagedRect );
+
+  /**
+   * Gets the age of the back buffer of a surface
+   * @param[in] eglSurface The surface to query
+   * @return The buffer age, or 0 if the contents are undefined or partial update is not enabled
+   */
+  EGLint GetBufferAge( EGLSurface& eglSurface ) const;
+
   /**
    * Performs an OpenGL copy buffers command
    */
@@ -249,6 +266,10 @@ private:
   bool                 mStencilBufferRequired;
   bool                 mIsSurfacelessContextSupported;
   bool                 mIsKhrCreateContextSupported;
+  bool                 mPartialUpdateRequired;
+  bool                 mIsBufferAgeSupported;
+
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC mEglSwapBuffersWithDamageKHR; ///< Null if EGL_KHR_swap_buffers_with_damage is not supported
 
   uint32_t              mSwapBufferCountAfterResume;
 };
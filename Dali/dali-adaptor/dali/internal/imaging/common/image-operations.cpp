@@ -29,6 +29,18 @@
 #include <third-party/resampler/resampler.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 
+// SSE2 is always available on x86-64, and on 32-bit x86 when the compiler is asked to use it; NEON is used when the compiler targets it.
+// Define DALI_IMAGE_OPERATIONS_DISABLE_SIMD to fall back to the scalar implementation, e.g. for comparison.
+#if !defined( DALI_IMAGE_OPERATIONS_DISABLE_SIMD )
+#if defined( __ARM_NEON__ ) || defined( __ARM_NEON )
+#define DALI_IMAGE_OPERATIONS_USE_NEON
+#include <arm_neon.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define DALI_IMAGE_OPERATIONS_USE_SSE
+#include <emmintrin.h>
+#endif
+#endif
+
 // INTERNAL INCLUDES
 
 namespace Dali
@@ -1182,6 +1194,44 @@ bool ContinueScaling( BoxDimensionTest test, unsigned int scaledWidth, unsigned
   return keepScaling;
 }
 
+#if defined( DALI_IMAGE_OPERATIONS_USE_SSE )
+/**
+ * @brief Average 16 pairs of bytes, rounding down like AverageComponent().
+ */
+inline __m128i AverageBytesSse( __m128i a, __m128i b )
+{
+  // _mm_avg_epu8 rounds up, so take off the bit lost when the sum is odd:
+  return _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi8( 1 ) ) );
+}
+#endif
+
+/**
+ * @brief Average the bytes of two scanlines 16 at a time, rounding down like AverageComponent().
+ * @note The output may overlap the first scanline as long as it does not start after it.
+ * @return The number of bytes averaged; the caller averages the remaining ones.
+ */
+inline unsigned int AverageScanlineBytes( const unsigned char * const scanline1,
+                                          const unsigned char * const __restrict__ scanline2,
+                                          unsigned char * const outputScanline,
+                                          const unsigned int count )
+{
+  unsigned int component = 0;
+#if defined( DALI_IMAGE_OPERATIONS_USE_SSE )
+  for( ; component + 16u <= count; component += 16u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline1 + component ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline2 + component ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outputScanline + component ), AverageBytesSse( a, b ) );
+  }
+#elif defined( DALI_IMAGE_OPERATIONS_USE_NEON )
+  for( ; component + 16u <= count; component += 16u )
+  {
+    vst1q_u8( outputScanline + component, vhaddq_u8( vld1q_u8( scanline1 + component ), vld1q_u8( scanline2 + component ) ) );
+  }
+#endif
+  return component;
+}
+
 /**
  * @brief A shared implementation of the overall iterative box filter
  * downscaling algorithm.
@@ -1256,8 +1306,22 @@ void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned in
   DebugAssertScanlineParameters( pixels, width );
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined( DALI_IMAGE_OPERATIONS_USE_NEON )
+  // Halve 16 pixels at a time; the stores never overtake the loads:
+  for( ; pixel + 16u <= width; pixel += 16u, outPixel += 8u )
+  {
+    const uint8x16x3_t in = vld3q_u8( &pixels[pixel * 3] );
+    uint8x8x3_t out;
+    out.val[0] = vshrn_n_u16( vpaddlq_u8( in.val[0] ), 1 );
+    out.val[1] = vshrn_n_u16( vpaddlq_u8( in.val[1] ), 1 );
+    out.val[2] = vshrn_n_u16( vpaddlq_u8( in.val[2] ), 1 );
+    vst3_u8( &pixels[outPixel * 3], out );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c11 = pixels[pixel * 3];
@@ -1282,8 +1346,28 @@ void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned
   uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // Halve 8 pixels at a time; the stores never overtake the loads:
+#if defined( DALI_IMAGE_OPERATIONS_USE_SSE )
+  for( ; pixel + 8u <= width; pixel += 8u, outPixel += 4u )
+  {
+    const __m128 first = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( &alignedPixels[pixel] ) ) );
+    const __m128 second = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( &alignedPixels[pixel + 4u] ) ) );
+    const __m128i even = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m128i odd = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( &alignedPixels[outPixel] ), AverageBytesSse( even, odd ) );
+  }
+#elif defined( DALI_IMAGE_OPERATIONS_USE_NEON )
+  for( ; pixel + 8u <= width; pixel += 8u, outPixel += 4u )
+  {
+    const uint32x4x2_t in = vld2q_u32( &alignedPixels[pixel] );
+    const uint8x16_t averaged = vhaddq_u8( vreinterpretq_u8_u32( in.val[0] ), vreinterpretq_u8_u32( in.val[1] ) );
+    vst1q_u32( &alignedPixels[outPixel], vreinterpretq_u32_u8( averaged ) );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     const uint32_t averaged = AveragePixelRGBA8888( alignedPixels[pixel], alignedPixels[pixel + 1] );
     alignedPixels[outPixel] = averaged;
@@ -1331,8 +1415,28 @@ void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int
   DebugAssertScanlineParameters( pixels, width );
 
   const unsigned int lastPair = EvenDown( width - 2 );
+  unsigned int pixel = 0, outPixel = 0;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  // Halve 32 pixels at a time; the stores never overtake the loads:
+#if defined( DALI_IMAGE_OPERATIONS_USE_SSE )
+  const __m128i lowBytes = _mm_set1_epi16( 0x00ff );
+  for( ; pixel + 32u <= width; pixel += 32u, outPixel += 16u )
+  {
+    const __m128i first = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &pixels[pixel] ) );
+    const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &pixels[pixel + 16u] ) );
+    const __m128i firstAveraged = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( first, lowBytes ), _mm_srli_epi16( first, 8 ) ), 1 );
+    const __m128i secondAveraged = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( second, lowBytes ), _mm_srli_epi16( second, 8 ) ), 1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( &pixels[outPixel] ), _mm_packus_epi16( firstAveraged, secondAveraged ) );
+  }
+#elif defined( DALI_IMAGE_OPERATIONS_USE_NEON )
+  for( ; pixel + 32u <= width; pixel += 32u, outPixel += 16u )
+  {
+    const uint8x16x2_t in = vld2q_u8( &pixels[pixel] );
+    vst1q_u8( &pixels[outPixel], vhaddq_u8( in.val[0], in.val[1] ) );
+  }
+#endif
+
+  for( ; pixel <= lastPair; pixel += 2, ++outPixel )
   {
     // Load all the byte pixel components we need:
     const unsigned int c1 = pixels[pixel];
@@ -1343,10 +1447,6 @@ void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int
   }
 }
 
-/**
- * @ToDo: Optimise for ARM using a 4 bytes at a time loop wrapped around the single ARMV6 instruction: UHADD8  R4, R0, R5. Note, this is not neon. It runs in the normal integer pipeline so there is no downside like a stall moving between integer and copro, or extra power for clocking-up the idle copro.
- * if (widthInComponents >= 7) { word32* aligned1 = scanline1 + 3 & 3; word32* aligned1_end = scanline1 + widthInPixels & 3; while(aligned1 < aligned1_end) { UHADD8  *aligned1++, *aligned2++, *alignedoutput++ } .. + 0 to 3 spare pixels at each end.
- */
 void AverageScanlines1( const unsigned char * const scanline1,
                         const unsigned char * const __restrict__ scanline2,
                         unsigned char* const outputScanline,
@@ -1354,7 +1454,7 @@ void AverageScanlines1( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width );
 
-  for( unsigned int component = 0; component < width; ++component )
+  for( unsigned int component = AverageScanlineBytes( scanline1, scanline2, outputScanline, width ); component < width; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1367,7 +1467,7 @@ void AverageScanlines2( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
 
-  for( unsigned int component = 0; component < width * 2; ++component )
+  for( unsigned int component = AverageScanlineBytes( scanline1, scanline2, outputScanline, width * 2 ); component < width * 2; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1380,7 +1480,7 @@ void AverageScanlines3( const unsigned char * const scanline1,
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 3 );
 
-  for( unsigned int component = 0; component < width * 3; ++component )
+  for( unsigned int component = AverageScanlineBytes( scanline1, scanline2, outputScanline, width * 3 ); component < width * 3; ++component )
   {
     outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
   }
@@ -1400,7 +1500,7 @@ void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
   const uint32_t* const alignedScanline2 = reinterpret_cast<const uint32_t*>(scanline2);
   uint32_t* const alignedOutput = reinterpret_cast<uint32_t*>(outputScanline);
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  for( unsigned int pixel = AverageScanlineBytes( scanline1, scanline2, outputScanline, width * 4 ) / 4; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGBA8888( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -1778,10 +1878,47 @@ inline PixelRGB565 BilinearFilterRGB565( PixelRGB565 tl, PixelRGB565 tr, PixelRG
 inline Pixel4Bytes BilinearFilter4Bytes( Pixel4Bytes tl, Pixel4Bytes tr, Pixel4Bytes bl, Pixel4Bytes br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
 {
   Pixel4Bytes pixel;
+#if defined( DALI_IMAGE_OPERATIONS_USE_SSE )
+  // The fixed-point arithmetic of BilinearFilter1Component(), on the four components at once.
+  uint32_t tlBits, trBits, blBits, brBits;
+  memcpy( &tlBits, &tl, sizeof( tlBits ) );
+  memcpy( &trBits, &tr, sizeof( trBits ) );
+  memcpy( &blBits, &bl, sizeof( blBits ) );
+  memcpy( &brBits, &br, sizeof( brBits ) );
+
+  // The top then the bottom components, widened to 16 bits:
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i left = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( static_cast<int>( tlBits ) ), _mm_cvtsi32_si128( static_cast<int>( blBits ) ) ), zero );
+  const __m128i right = _mm_unpacklo_epi8( _mm_unpacklo_epi32( _mm_cvtsi32_si128( static_cast<int>( trBits ) ), _mm_cvtsi32_si128( static_cast<int>( brBits ) ) ), zero );
+
+  // Horizontal blend to 16.16 fixed point, from the low and high halves of the 16 x 16 bit products:
+  const __m128i leftWeight = _mm_set1_epi16( static_cast<short>( 65535u - fractBlendHorizontal ) );
+  const __m128i rightWeight = _mm_set1_epi16( static_cast<short>( fractBlendHorizontal ) );
+  const __m128i leftLow = _mm_mullo_epi16( left, leftWeight );
+  const __m128i leftHigh = _mm_mulhi_epu16( left, leftWeight );
+  const __m128i rightLow = _mm_mullo_epi16( right, rightWeight );
+  const __m128i rightHigh = _mm_mulhi_epu16( right, rightWeight );
+  const __m128i top = _mm_add_epi32( _mm_unpacklo_epi16( leftLow, leftHigh ), _mm_unpacklo_epi16( rightLow, rightHigh ) );
+  const __m128i bottom = _mm_add_epi32( _mm_unpackhi_epi16( leftLow, leftHigh ), _mm_unpackhi_epi16( rightLow, rightHigh ) );
+
+  // Vertical blend to 16.32 fixed point, for the r and b components, then for the g and a components:
+  const __m128i topWeight = _mm_set1_epi32( static_cast<int>( 65535u - fractBlendVertical ) );
+  const __m128i bottomWeight = _mm_set1_epi32( static_cast<int>( fractBlendVertical ) );
+  const __m128i half = _mm_set_epi32( 0, static_cast<int>( 1u << 31u ), 0, static_cast<int>( 1u << 31u ) );
+  const __m128i even = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( top, topWeight ), _mm_mul_epu32( bottom, bottomWeight ) ), half );
+  const __m128i odd = _mm_add_epi64( _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( top, 32 ), topWeight ),
+                                                    _mm_mul_epu32( _mm_srli_epi64( bottom, 32 ), bottomWeight ) ), half );
+
+  // The rounded components are the integer parts, in the upper halves of the 64 bit lanes:
+  const __m128i rounded = _mm_or_si128( _mm_srli_epi64( even, 32 ), _mm_and_si128( odd, _mm_set_epi32( -1, 0, -1, 0 ) ) );
+  const uint32_t pixelBits = static_cast<uint32_t>( _mm_cvtsi128_si32( _mm_packus_epi16( _mm_packs_epi32( rounded, zero ), zero ) ) );
+  memcpy( &pixel, &pixelBits, sizeof( pixel ) );
+#else
   pixel.r = static_cast<uint8_t>( BilinearFilter1Component( tl.r, tr.r, bl.r, br.r, fractBlendHorizontal, fractBlendVertical ) );
   pixel.g = static_cast<uint8_t>( BilinearFilter1Component( tl.g, tr.g, bl.g, br.g, fractBlendHorizontal, fractBlendVertical ) );
   pixel.b = static_cast<uint8_t>( BilinearFilter1Component( tl.b, tr.b, bl.b, br.b, fractBlendHorizontal, fractBlendVertical ) );
   pixel.a = static_cast<uint8_t>( BilinearFilter1Component( tl.a, tr.a, bl.a, br.a, fractBlendHorizontal, fractBlendVertical ) );
+#endif
   return pixel;
 }
 
@@ -291,6 +291,11 @@ public:
    */
   bool StencilBufferRequired() const;
 
+  /**
+   * @return Whether only the changed area of the surface should be redrawn, if the back buffer age is available.
+   */
+  bool PartialUpdateRequired() const;
+
   /// Deleted copy constructor.
   EnvironmentOptions( const EnvironmentOptions& ) = delete;
 
@@ -353,6 +358,7 @@ private: // Data
   bool mGlesCallAccumulate;                       ///< Whether or not to accumulate gles call statistics
   bool mDepthBufferRequired;                      ///< Whether the depth buffer is required
   bool mStencilBufferRequired;                    ///< Whether the stencil buffer is required
+  bool mPartialUpdateRequired;                    ///< Whether partial update is required
   std::unique_ptr<TraceManager> mTraceManager;    ///< TraceManager
 };
 
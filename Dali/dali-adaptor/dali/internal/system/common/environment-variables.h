@@ -116,6 +116,8 @@ namespace Adaptor
 
 #define DALI_ENV_DISABLE_STENCIL_BUFFER "DALI_DISABLE_STENCIL_BUFFER"
 
+#define DALI_ENV_PARTIAL_UPDATE "DALI_PARTIAL_UPDATE"
+
 #define DALI_ENV_WEB_ENGINE_NAME "DALI_WEB_ENGINE_NAME"
 
 #define DALI_ENV_DPI_HORIZONTAL "DALI_DPI_HORIZONTAL"
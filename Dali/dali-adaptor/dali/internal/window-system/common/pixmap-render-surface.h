@@ -79,6 +79,22 @@ public: // API
     return mGraphics ? mGraphics->GetStencilBufferRequired() : Integration::StencilBufferAvailable::FALSE;
   }
 
+  /**
+   * @copydoc Dali::Integration::RenderSurface::GetBufferAge()
+   */
+  int32_t GetBufferAge() override
+  {
+    // Partial update is not supported for pixmaps; the whole surface is always redrawn
+    return 0;
+  }
+
+  /**
+   * @copydoc Dali::Integration::RenderSurface::SetDamagedRect()
+   */
+  void SetDamagedRect( const Rect<int32_t>& damagedRect ) override
+  {
+  }
+
 private:
 
   /**
@@ -198,6 +198,16 @@ public: // from Dali::Integration::RenderSurface
    */
   virtual Integration::StencilBufferAvailable GetStencilBufferRequired() override;
 
+  /**
+   * @copydoc Dali::Integration::RenderSurface::GetBufferAge()
+   */
+  virtual int32_t GetBufferAge() override;
+
+  /**
+   * @copydoc Dali::Integration::RenderSurface::SetDamagedRect()
+   */
+  virtual void SetDamagedRect( const Rect<int32_t>& damagedRect ) override;
+
 private:
 
   /**
@@ -235,6 +245,7 @@ private: // Data
   GraphicsInterface*              mGraphics;           ///< Graphics interface
   EGLSurface                      mEGLSurface;
   EGLContext                      mEGLContext;
+  Rect<int32_t>                   mDamagedRect;        ///< The area redrawn in the current frame; empty if the whole surface was redrawn
   ColorDepth                      mColorDepth;         ///< Color depth of surface (32 bit or 24 bit)
   OutputSignalType                mOutputTransformedSignal;
   int                             mRotationAngle;
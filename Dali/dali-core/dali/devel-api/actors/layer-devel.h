@@ -27,6 +27,27 @@ namespace Dali
 namespace DevelLayer
 {
 
+namespace Property
+{
+
+enum Type
+{
+  CLIPPING_ENABLE = Dali::Layer::Property::CLIPPING_ENABLE,
+  CLIPPING_BOX    = Dali::Layer::Property::CLIPPING_BOX,
+  BEHAVIOR        = Dali::Layer::Property::BEHAVIOR,
+
+  /**
+   * @brief Whether the opaque renderers of a LAYER_3D layer are sorted to minimise render state changes.
+   * @details Name "sortByRenderState", type Property::BOOLEAN.
+   * @note The opaque renderers are drawn in an order given by a key packing their shader, texture set and
+   * geometry, then front to back. Their order is otherwise undefined, which is only correct when the depth test is enabled.
+   * @note This is false by default, and has no effect on LAYER_UI layers, transparent renderers or layers containing clipping actors.
+   */
+  SORT_BY_RENDER_STATE = BEHAVIOR + 1,
+};
+
+} // namespace Property
+
   /**
    * @brief ACTOR_DEPTH_MULTIPLIER is used by the rendering sorting algorithm to decide which actors to render first.
    * @SINCE_1_0.0
@@ -47,6 +47,15 @@ std::size_t CalculateHash( const std::string& toHash)
   return hash;
 }
 
+std::size_t CalculateHash( const char* toHash )
+{
+  std::size_t hash( INITIAL_HASH_VALUE );
+
+  HashString( toHash, hash );
+
+  return hash;
+}
+
 std::size_t CalculateHash( const std::string& string1, const std::string& string2 )
 {
   std::size_t hash( INITIAL_HASH_VALUE );
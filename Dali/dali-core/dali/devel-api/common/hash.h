@@ -39,6 +39,14 @@ enum
  */
 DALI_CORE_API std::size_t CalculateHash( const std::string& toHash );
 
+/**
+ * @brief Create a hash code for a null terminated string
+ * Gives the same hash code as the std::string version without constructing a string.
+ * @param toHash string to hash
+ * @return hash code
+ */
+DALI_CORE_API std::size_t CalculateHash( const char* toHash );
+
 /**
  * @brief Create a hash code for 2 strings combined.
  * Allows a hash to be calculated without concatenating the strings and allocating any memory.
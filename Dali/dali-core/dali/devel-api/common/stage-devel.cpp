@@ -40,6 +40,31 @@ Rendering GetRenderingBehavior( Dali::Stage stage )
   return GetImplementation( stage ).GetRenderingBehavior();
 }
 
+void SetParallelTransformUpdate( Dali::Stage stage, uint32_t threadCount, uint32_t componentThreshold )
+{
+  GetImplementation( stage ).SetParallelTransformUpdate( threadCount, componentThreshold );
+}
+
+void SetParallelAnimation( Dali::Stage stage, uint32_t threadCount, uint32_t animatorThreshold )
+{
+  GetImplementation( stage ).SetParallelAnimation( threadCount, animatorThreshold );
+}
+
+void SetHitTestAcceleration( Dali::Stage stage, bool enabled )
+{
+  GetImplementation( stage ).SetHitTestAcceleration( enabled );
+}
+
+void SetMessageCoalescing( Dali::Stage stage, bool enabled )
+{
+  GetImplementation( stage ).SetMessageCoalescing( enabled );
+}
+
+uint32_t GetCoalescedMessageCount( Dali::Stage stage )
+{
+  return GetImplementation( stage ).GetCoalescedMessageCount();
+}
+
 void AddFrameCallback( Dali::Stage stage, FrameCallbackInterface& frameCallback, Actor rootActor )
 {
   GetImplementation( stage ).AddFrameCallback( frameCallback, GetImplementation( rootActor ) );
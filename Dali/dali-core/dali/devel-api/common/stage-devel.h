@@ -67,6 +67,74 @@ DALI_CORE_API void SetRenderingBehavior( Dali::Stage stage, Rendering renderingB
  */
 DALI_CORE_API Rendering GetRenderingBehavior( Dali::Stage stage );
 
+/**
+ * @brief Sets whether the world transforms of the actors are calculated by several threads.
+ *
+ * Each level of the actor hierarchy is split between the threads, which only pays off for large scenes.
+ *
+ * @param[in] stage The stage
+ * @param[in] threadCount The number of worker threads to use, or 0 to calculate the transforms in the update-thread only
+ * @param[in] componentThreshold The minimum number of actors in the scene for the transforms to be calculated in parallel
+ *
+ * @note By default, the transforms are calculated in the update-thread only.
+ */
+DALI_CORE_API void SetParallelTransformUpdate( Dali::Stage stage, uint32_t threadCount, uint32_t componentThreshold );
+
+/**
+ * @brief Sets whether the animators of all the playing animations are applied by several threads.
+ *
+ * The animators are split by the object they animate, so the animated values are the same as when applied serially.
+ * Custom alpha functions and animator functions must then be safe to call from several threads.
+ *
+ * @param[in] stage The stage
+ * @param[in] threadCount The number of worker threads to use, or 0 to apply the animators in the update-thread only
+ * @param[in] animatorThreshold The minimum number of animators to apply in a frame for them to be applied in parallel
+ *
+ * @note By default, the animators are applied in the update-thread only.
+ */
+DALI_CORE_API void SetParallelAnimation( Dali::Stage stage, uint32_t threadCount, uint32_t animatorThreshold );
+
+/**
+ * @brief Sets whether hit testing skips the actor sub-trees that the touch, hover or wheel ray cannot hit.
+ *
+ * When enabled, the update-thread computes a bounding sphere of each actor and all its descendants
+ * whenever the transforms change, and hit testing skips a sub-tree whose sphere is missed by the ray.
+ * This pays off for scenes with many actors.
+ *
+ * @param[in] stage The stage
+ * @param[in] enabled True to compute the bounding spheres
+ *
+ * @note By default, hit testing tests every actor.
+ * @note Like the transforms, changes to the actor hierarchy are taken into account by the next update.
+ * @note The spheres are those of the last completed update, while each actor is tested at its latest world transform.
+ * The results of hit testing are the same for actors that are not moving; an actor that moves out of the sphere of
+ * its sub-tree while the update-thread is running can be missed until the next update completes.
+ */
+DALI_CORE_API void SetHitTestAcceleration( Dali::Stage stage, bool enabled );
+
+/**
+ * @brief Sets whether repeated property sets are coalesced before they are sent to the update-thread.
+ *
+ * When enabled, setting the same property of the same object several times before the messages are flushed
+ * sends only the last value, so the update-thread bakes it once.
+ * Component (e.g. POSITION_X) and relative (e.g. TranslateBy) changes are still sent individually.
+ *
+ * @param[in] stage The stage
+ * @param[in] enabled True to coalesce the property sets
+ *
+ * @note By default, every property set is sent to the update-thread.
+ */
+DALI_CORE_API void SetMessageCoalescing( Dali::Stage stage, bool enabled );
+
+/**
+ * @brief Retrieves the number of property sets which were not sent to the update-thread because of coalescing.
+ *
+ * @param[in] stage The stage
+ * @return The number of coalesced property sets since the application started
+ * @see SetMessageCoalescing
+ */
+DALI_CORE_API uint32_t GetCoalescedMessageCount( Dali::Stage stage );
+
 /*
  * @brief The FrameCallbackInterface implementation added gets called on every frame from the update-thread.
  *
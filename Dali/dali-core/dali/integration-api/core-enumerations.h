@@ -56,6 +56,15 @@ enum class StencilBufferAvailable
   TRUE
 };
 
+/**
+ * @brief Enumerations to specify whether the surfaces can be partially updated.
+ */
+enum class PartialUpdateAvailable
+{
+  FALSE = 0,
+  TRUE
+};
+
 } // namespace Integration
 
 } // namespace Dali
@@ -183,6 +183,20 @@ public:
    */
   virtual Integration::StencilBufferAvailable GetStencilBufferRequired() = 0;
 
+  /**
+   * @brief Gets the age of the back buffer, i.e. the number of frames since its contents were last presented
+   * @note This is queried by the render thread before rendering to decide whether a partial update is possible.
+   * @return The buffer age, or 0 if the contents of the back buffer are undefined (and the whole surface must be redrawn)
+   */
+  virtual int32_t GetBufferAge() = 0;
+
+  /**
+   * @brief Sets the area of the surface that was redrawn in the current frame
+   * @note This is called by the render thread before PostRender; the surface may use it to present only the damaged area.
+   * @param[in] damagedRect The damaged area in surface coordinates (origin at the bottom-left), or an empty rectangle if the whole surface was redrawn
+   */
+  virtual void SetDamagedRect( const Rect<int32_t>& damagedRect ) = 0;
+
 private:
 
   /**
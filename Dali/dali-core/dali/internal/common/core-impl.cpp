@@ -89,7 +89,8 @@ Core::Core( RenderController& renderController,
             ResourcePolicy::DataRetention dataRetentionPolicy,
             Integration::RenderToFrameBuffer renderToFboEnabled,
             Integration::DepthBufferAvailable depthBufferAvailable,
-            Integration::StencilBufferAvailable stencilBufferAvailable )
+            Integration::StencilBufferAvailable stencilBufferAvailable,
+            Integration::PartialUpdateAvailable partialUpdateAvailable )
 : mRenderController( renderController ),
   mPlatform(platform),
   mProcessingEvent(false),
@@ -107,9 +108,9 @@ Core::Core( RenderController& renderController,
 
   mPropertyNotificationManager = PropertyNotificationManager::New();
 
-  mRenderTaskProcessor = new SceneGraph::RenderTaskProcessor();
+  mRenderTaskProcessor = new SceneGraph::RenderTaskProcessor( partialUpdateAvailable );
 
-  mRenderManager = RenderManager::New( glAbstraction, glSyncAbstraction, glContextHelperAbstraction, depthBufferAvailable, stencilBufferAvailable );
+  mRenderManager = RenderManager::New( glAbstraction, glSyncAbstraction, glContextHelperAbstraction, depthBufferAvailable, stencilBufferAvailable, partialUpdateAvailable );
 
   RenderQueue& renderQueue = mRenderManager->GetRenderQueue();
 
@@ -458,6 +459,11 @@ uint32_t* Core::ReserveMessageSlot( uint32_t size, bool updateScene )
   return mUpdateManager->ReserveMessageSlot( size, updateScene );
 }
 
+uint32_t* Core::ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene )
+{
+  return mUpdateManager->ReserveCoalescableMessageSlot( property, size, updateScene );
+}
+
 BufferIndex Core::GetEventBufferIndex() const
 {
   return mUpdateManager->GetEventBufferIndex();
@@ -88,7 +88,8 @@ public:
         ResourcePolicy::DataRetention dataRetentionPolicy,
         Integration::RenderToFrameBuffer renderToFboEnabled,
         Integration::DepthBufferAvailable depthBufferAvailable,
-        Integration::StencilBufferAvailable stencilBufferAvailable );
+        Integration::StencilBufferAvailable stencilBufferAvailable,
+        Integration::PartialUpdateAvailable partialUpdateAvailable );
 
   /**
    * Destructor
@@ -207,6 +208,11 @@ public: // Implementation of EventThreadServices
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene ) override;
 
+  /**
+   * @copydoc EventThreadServices::ReserveCoalescableMessageSlot
+   */
+  uint32_t* ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene ) override;
+
   /**
    * @copydoc EventThreadServices::GetEventBufferIndex
    */
@@ -105,6 +105,18 @@ std::size_t MessageBuffer::GetCapacity() const
   return mCapacity * WORD_SIZE;
 }
 
+std::size_t MessageBuffer::GetMessageOffset( const uint32_t* slot ) const
+{
+  return static_cast<std::size_t>( reinterpret_cast<const WordType*>( slot ) - mData );
+}
+
+uint32_t* MessageBuffer::GetMessageSlot( std::size_t offset ) const
+{
+  DALI_ASSERT_DEBUG( offset < mSize );
+
+  return reinterpret_cast<uint32_t*>( mData + offset );
+}
+
 MessageBuffer::Iterator MessageBuffer::Begin() const
 {
   if ( 0 != mSize )
@@ -62,6 +62,21 @@ public:
    */
   std::size_t GetCapacity() const;
 
+  /**
+   * Query the position of a message in the buffer.
+   * Unlike the address of the message, the position remains valid when the buffer grows.
+   * @param[in] slot A pointer returned by ReserveMessageSlot()
+   * @return The position of the message with respect to the size of WordType.
+   */
+  std::size_t GetMessageOffset( const uint32_t* slot ) const;
+
+  /**
+   * Retrieve a message from its position in the buffer.
+   * @param[in] offset The position returned by GetMessageOffset()
+   * @return A pointer to the address allocated for the message.
+   */
+  uint32_t* GetMessageSlot( std::size_t offset ) const;
+
   /**
    * Used to iterate though the messages in the buffer.
    */
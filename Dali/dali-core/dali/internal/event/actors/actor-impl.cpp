@@ -92,6 +92,13 @@ inline const Vector2& GetDefaultDimensionPadding()
 
 const SizeScalePolicy::Type DEFAULT_SIZE_SCALE_POLICY = SizeScalePolicy::USE_SIZE_SET;
 
+/// The radius of a sub-tree bounding sphere is scaled and increased by these, to cover the rounding of the sphere merges
+const float SUBTREE_SPHERE_MARGIN_SCALE = 1.001f;
+const float SUBTREE_SPHERE_MARGIN = 1.0f;
+
+/// Collects the nodes of the actors destroyed along with an actor sub-tree, so they are destroyed with a single message
+SceneGraph::NodeContainer* gDestroyedNodes = NULL;
+
 } // unnamed namespace
 
 /**
@@ -1691,6 +1698,26 @@ bool Actor::RaySphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) con
   return ( b2 * b2 - a * c ) >= 0.f;
 }
 
+bool Actor::RaySubtreeSphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const
+{
+  Vector4 sphere;
+  if( !GetNode().GetSubtreeBoundingSphere( GetEventThreadServices().GetEventBufferIndex(), sphere ) || std::isinf( sphere.w ) )
+  {
+    // The actors of the sub-tree have to be tested individually
+    return true;
+  }
+
+  // As RaySphereTest(), with a margin for the rounding of the sphere merges
+  Vector3 rayOriginLocal( rayOrigin.x - sphere.x, rayOrigin.y - sphere.y, rayOrigin.z - sphere.z );
+  const float radius = sphere.w * SUBTREE_SPHERE_MARGIN_SCALE + SUBTREE_SPHERE_MARGIN;
+
+  float a = rayDir.Dot( rayDir );
+  float b2 = rayDir.Dot( rayOriginLocal );
+  float c = rayOriginLocal.Dot( rayOriginLocal ) - radius * radius;
+
+  return ( b2 * b2 - a * c ) >= 0.f;
+}
+
 bool Actor::RayActorTest( const Vector4& rayOrigin, const Vector4& rayDir, Vector2& hitPointLocal, float& distance ) const
 {
   bool hit = false;
@@ -2067,6 +2094,15 @@ void Actor::Initialize()
 
 Actor::~Actor()
 {
+  // If no ancestor is being destroyed, the nodes of the children destroyed with this actor are collected here
+  OwnerPointer< SceneGraph::NodeContainer > destroyedNodes;
+  const bool collectDestroyedNodes = mChildren && !gDestroyedNodes && EventThreadServices::IsCoreRunning();
+  if( collectDestroyedNodes )
+  {
+    gDestroyedNodes = new SceneGraph::NodeContainer();
+    destroyedNodes = gDestroyedNodes;
+  }
+
   // Remove mParent pointers from children even if we're destroying core,
   // to guard against GetParent() & Unparent() calls from CustomActor destructors.
   if( mChildren )
@@ -2086,10 +2122,35 @@ Actor::~Actor()
     // Root layer will destroy its node in its own destructor
     if ( !mIsRoot )
     {
-      DestroyNodeMessage( GetEventThreadServices().GetUpdateManager(), GetNode() );
+      if( gDestroyedNodes )
+      {
+        gDestroyedNodes->PushBack( const_cast< SceneGraph::Node* >( &GetNode() ) );
+      }
+      else
+      {
+        DestroyNodeMessage( GetEventThreadServices().GetUpdateManager(), GetNode() );
+      }
 
       GetEventThreadServices().UnregisterObject( this );
     }
+
+    // Send the nodes of the whole sub-tree at once
+    if( collectDestroyedNodes )
+    {
+      if( destroyedNodes->Count() > 1u )
+      {
+        DestroyNodesMessage( GetEventThreadServices().GetUpdateManager(), destroyedNodes );
+      }
+      else if( destroyedNodes->Count() == 1u )
+      {
+        DestroyNodeMessage( GetEventThreadServices().GetUpdateManager(), *( *destroyedNodes )[0] );
+      }
+    }
+  }
+
+  if( collectDestroyedNodes )
+  {
+    gDestroyedNodes = NULL;
   }
 
   // Cleanup optional gesture data
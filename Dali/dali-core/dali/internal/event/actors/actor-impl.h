@@ -1307,6 +1307,16 @@ public:
    */
   bool RaySphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const;
 
+  /**
+   * Performs a ray-sphere test with the given pick-ray and the bounding sphere of the actor and all its descendants.
+   * The sphere is from the last completed update. If this fails, the ray-sphere test of the actor and of each of its
+   * descendants fails as well, unless they have moved since, as RaySphereTest() reads the latest world transforms.
+   * @param[in] rayOrigin The ray origin in the world's reference system.
+   * @param[in] rayDir The ray director vector in the world's reference system.
+   * @return True if the ray intersects the bounding sphere, or if the sphere is not available.
+   */
+  bool RaySubtreeSphereTest( const Vector4& rayOrigin, const Vector4& rayDir ) const;
+
   /**
    * Performs a ray-actor test with the given pick-ray and the actor's geometry.
    * @note The actor coordinates are relative to the top-left (0.0, 0.0, 0.5)
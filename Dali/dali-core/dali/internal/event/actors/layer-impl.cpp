@@ -24,6 +24,7 @@
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/object/type-registry.h>
+#include <dali/devel-api/actors/layer-devel.h>
 #include <dali/internal/event/actors/layer-list.h>
 #include <dali/internal/event/common/property-helper.h>
 #include <dali/internal/event/common/scene-impl.h>
@@ -59,6 +60,7 @@ DALI_PROPERTY_TABLE_BEGIN
 DALI_PROPERTY( "clippingEnable",    BOOLEAN,    true,    false,   true,   Dali::Layer::Property::CLIPPING_ENABLE )
 DALI_PROPERTY( "clippingBox",       RECTANGLE,  true,    false,   true,   Dali::Layer::Property::CLIPPING_BOX    )
 DALI_PROPERTY( "behavior",          STRING,     true,    false,   false,  Dali::Layer::Property::BEHAVIOR        )
+DALI_PROPERTY( "sortByRenderState", BOOLEAN,    true,    false,   false,  Dali::DevelLayer::Property::SORT_BY_RENDER_STATE )
 DALI_PROPERTY_TABLE_END( DEFAULT_DERIVED_ACTOR_PROPERTY_START_INDEX, LayerDefaultProperties )
 
 // Actions
@@ -128,6 +130,7 @@ Layer::Layer( Actor::DerivedType type, const SceneGraph::Layer& layer )
   mBehavior( Dali::Layer::LAYER_UI ),
   mIsClipping( false ),
   mDepthTestDisabled( true ),
+  mSortByRenderState( false ),
   mTouchConsumed( false ),
   mHoverConsumed( false )
 {
@@ -295,6 +298,22 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetSortByRenderState( bool enable )
+{
+  if( enable != mSortByRenderState )
+  {
+    mSortByRenderState = enable;
+
+    // layerNode is being used in a separate thread; queue a message to set the value
+    SetSortByRenderStateMessage( GetEventThreadServices(), GetSceneLayerOnStage(), mSortByRenderState );
+  }
+}
+
+bool Layer::IsSortByRenderState() const
+{
+  return mSortByRenderState;
+}
+
 void Layer::SetSortFunction(Dali::Layer::SortFunctionType function)
 {
   if( function != mSortFunction )
@@ -390,6 +409,11 @@ void Layer::SetDefaultProperty( Property::Index index, const Property::Value& pr
         }
         break;
       }
+      case Dali::DevelLayer::Property::SORT_BY_RENDER_STATE:
+      {
+        SetSortByRenderState( propertyValue.Get<bool>() );
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING( "Unknown property (%d)\n", index );
@@ -426,6 +450,11 @@ Property::Value Layer::GetDefaultProperty( Property::Index index ) const
         ret = Scripting::GetLinearEnumerationName< Behavior >( GetBehavior(), BEHAVIOR_TABLE, BEHAVIOR_TABLE_COUNT );
         break;
       }
+      case Dali::DevelLayer::Property::SORT_BY_RENDER_STATE:
+      {
+        ret = mSortByRenderState;
+        break;
+      }
       default:
       {
         DALI_LOG_WARNING( "Unknown property (%d)\n", index );
@@ -172,6 +172,19 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * Set whether the opaque renderers of a LAYER_3D layer are sorted to minimise render state changes.
+   * @see Dali::DevelLayer::Property::SORT_BY_RENDER_STATE
+   * @param[in] enable True to sort by render state
+   */
+  void SetSortByRenderState( bool enable );
+
+  /**
+   * Query whether the opaque renderers are sorted to minimise render state changes.
+   * @return True if sorting by render state
+   */
+  bool IsSortByRenderState() const;
+
   /**
    * @copydoc Dali::Layer::SetSortFunction()
    */
@@ -264,6 +277,7 @@ private:
 
   bool mIsClipping:1;                           ///< True when clipping is enabled
   bool mDepthTestDisabled:1;                    ///< Whether depth test is disabled.
+  bool mSortByRenderState:1;                    ///< Whether opaque renderers are sorted by render state.
   bool mTouchConsumed:1;                        ///< Whether we should consume touch (including gesture).
   bool mHoverConsumed:1;                        ///< Whether we should consume hover.
 
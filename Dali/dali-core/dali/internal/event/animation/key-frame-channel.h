@@ -18,6 +18,9 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/internal/event/animation/progress-value.h>
 #include <dali/public-api/animation/animation.h>
@@ -78,9 +81,16 @@ public:
 
   V GetValue(float progress, Dali::Animation::Interpolation interpolation) const;
 
+  /**
+   * As GetValue(), starting the search from the interval found by the previous call.
+   * @param[in,out] segmentHint The index of the first key frame of the previous interval; updated with the new one
+   */
+  V GetValue(float progress, Dali::Animation::Interpolation interpolation, std::size_t& segmentHint) const;
+
   bool FindInterval(typename ProgressValues::iterator& start,
                     typename ProgressValues::iterator& end,
-                    float progress) const;
+                    float progress,
+                    std::size_t& segmentHint) const;
 
   ProgressValues& mValues;
 };
@@ -102,44 +112,52 @@ bool KeyFrameChannel<V>::IsActive (float progress)
 }
 
 /**
- * Use a linear search to find the interval containing progress
+ * Find the interval containing progress, i.e. the last key frame at or before progress and the one after it.
+ * The key frames are in time order, so the interval is checked at the hint and the next one first, which
+ * is where it is found during playback; otherwise a binary search is used.
  */
 template <class V>
 bool KeyFrameChannel<V>::FindInterval(
   typename ProgressValues::iterator& start,
   typename ProgressValues::iterator& end,
-  float progress) const
+  float progress,
+  std::size_t& segmentHint) const
 {
-  bool found = false;
-  typename std::vector<ProgressValue<V> >::iterator iter = mValues.begin();
-  typename std::vector<ProgressValue<V> >::iterator prevIter = iter;
-
-  while(iter != mValues.end() && iter->GetProgress() <= progress)
-  {
-    prevIter = iter;
-    ++iter;
-  }
-
-  if(iter == mValues.end())
+  const std::size_t count = mValues.size();
+  for( std::size_t segment = segmentHint; ( segment < segmentHint + 2u ) && ( segment + 1u < count ); ++segment )
   {
-    --prevIter;
-    --iter;
+    if( mValues[segment].GetProgress() <= progress && mValues[segment + 1u].GetProgress() > progress )
+    {
+      segmentHint = segment;
+      start = mValues.begin() + segment;
+      end   = start + 1;
+      return true;
+    }
   }
 
-  if(prevIter->GetProgress() <= progress
-     &&
-     iter->GetProgress() > progress)
+  typename ProgressValues::iterator iter = std::upper_bound( mValues.begin(), mValues.end(), progress,
+                                                             []( float value, const ProgressValue<V>& key ) { return value < key.GetProgress(); } );
+  if( iter == mValues.begin() || iter == mValues.end() )
   {
-    found = true;
-    start = prevIter;
-    end   = iter;
+    // Before the first key frame, or at or after the last one
+    return false;
   }
 
-  return found;
+  start = iter - 1;
+  end   = iter;
+  segmentHint = static_cast<std::size_t>( start - mValues.begin() );
+  return true;
 }
 
 template <class V>
 V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation interpolation) const
+{
+  std::size_t segmentHint = 0u;
+  return GetValue(progress, interpolation, segmentHint);
+}
+
+template <class V>
+V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation interpolation, std::size_t& segmentHint) const
 {
   ProgressValue<V>&  firstPV =  mValues.front();
 
@@ -151,7 +169,7 @@ V KeyFrameChannel<V>::GetValue (float progress, Dali::Animation::Interpolation i
   {
     interpolatedV = mValues.back().GetValue(); // This should probably be last value...
   }
-  else if(FindInterval(start, end, progress))
+  else if(FindInterval(start, end, progress, segmentHint))
   {
     float frameProgress = (progress - start->GetProgress()) / (end->GetProgress() - start->GetProgress());
 
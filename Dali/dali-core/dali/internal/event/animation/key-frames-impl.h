@@ -266,6 +266,17 @@ public:
   {
     return mKeyFrames->GetValue(progress, interpolation);
   }
+
+  /**
+   * Return an interpolated value for the given progress, starting the search from the previous interval.
+   * @param[in] progress The progress to test
+   * @param[in,out] segmentHint The interval found by the previous call, 0 initially
+   * @return The interpolated value
+   */
+  V GetValue(float progress, Dali::Animation::Interpolation interpolation, std::size_t& segmentHint) const
+  {
+    return mKeyFrames->GetValue(progress, interpolation, segmentHint);
+  }
 };
 
 typedef KeyFrameBaseSpec<float>          KeyFrameNumber;
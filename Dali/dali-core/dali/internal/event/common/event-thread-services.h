@@ -101,6 +101,18 @@ public:
    */
   virtual uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene = true ) = 0;
 
+  /**
+   * Reserve space for a message which sets the whole value of a property; this must then be initialized by the caller.
+   * When message coalescing is enabled, an earlier message for the same property which has not been flushed yet is dropped.
+   * @post Calling this method may invalidate any previously returned slots.
+   * @param[in] property The property which the message sets.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @param[in] updateScene A flag, when true denotes that the message will cause the scene-graph node tree to require an update.
+   * @return A pointer to the first char allocated for the message.
+   * @see Dali::DevelStage::SetMessageCoalescing()
+   */
+  virtual uint32_t* ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene = true ) = 0;
+
   /**
    * @return the current event-buffer index.
    */
@@ -217,6 +217,31 @@ DevelStage::Rendering Stage::GetRenderingBehavior() const
   return mRenderingBehavior;
 }
 
+void Stage::SetParallelTransformUpdate( uint32_t threadCount, uint32_t componentThreshold )
+{
+  SetParallelTransformUpdateMessage( mUpdateManager, threadCount, componentThreshold );
+}
+
+void Stage::SetParallelAnimation( uint32_t threadCount, uint32_t animatorThreshold )
+{
+  SetParallelAnimationMessage( mUpdateManager, threadCount, animatorThreshold );
+}
+
+void Stage::SetHitTestAcceleration( bool enabled )
+{
+  SetHitTestAccelerationMessage( mUpdateManager, enabled );
+}
+
+void Stage::SetMessageCoalescing( bool enabled )
+{
+  mUpdateManager.SetMessageCoalescing( enabled );
+}
+
+uint32_t Stage::GetCoalescedMessageCount() const
+{
+  return mUpdateManager.GetCoalescedMessageCount();
+}
+
 bool Stage::DoConnectSignal( BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor )
 {
   bool connected( true );
@@ -195,6 +195,31 @@ public:
    */
   DevelStage::Rendering GetRenderingBehavior() const;
 
+  /**
+   * @copydoc Dali::DevelStage::SetParallelTransformUpdate()
+   */
+  void SetParallelTransformUpdate( uint32_t threadCount, uint32_t componentThreshold );
+
+  /**
+   * @copydoc Dali::DevelStage::SetParallelAnimation()
+   */
+  void SetParallelAnimation( uint32_t threadCount, uint32_t animatorThreshold );
+
+  /**
+   * @copydoc Dali::DevelStage::SetHitTestAcceleration()
+   */
+  void SetHitTestAcceleration( bool enabled );
+
+  /**
+   * @copydoc Dali::DevelStage::SetMessageCoalescing()
+   */
+  void SetMessageCoalescing( bool enabled );
+
+  /**
+   * @copydoc Dali::DevelStage::GetCoalescedMessageCount()
+   */
+  uint32_t GetCoalescedMessageCount() const;
+
   /**
    * Callback for Internal::Scene EventProcessingFinished signal
    */
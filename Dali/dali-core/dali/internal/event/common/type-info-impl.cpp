@@ -501,6 +501,7 @@ void TypeInfo::AddProperty( const std::string& name, Property::Index index, Prop
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, setFunc, getFunc, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+      mPropertyNameLookupValid = false;
     }
     else
     {
@@ -526,6 +527,7 @@ void TypeInfo::AddProperty( const std::string& name, Property::Index index, Prop
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, setFunc, getFunc, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+      mPropertyNameLookupValid = false;
     }
     else
     {
@@ -544,6 +546,7 @@ void TypeInfo::AddAnimatableProperty( const std::string& name, Property::Index i
   if ( iter == mRegisteredProperties.end() )
   {
     mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+    mPropertyNameLookupValid = false;
   }
   else
   {
@@ -559,6 +562,7 @@ void TypeInfo::AddAnimatableProperty( const std::string& name, Property::Index i
   if ( iter == mRegisteredProperties.end() )
   {
     mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( defaultValue.GetType(), name, Property::INVALID_INDEX, Property::INVALID_COMPONENT_INDEX ) ) );
+    mPropertyNameLookupValid = false;
     mPropertyDefaultValues.push_back( PropertyDefaultValuePair( index, defaultValue ) );
   }
   else
@@ -585,6 +589,7 @@ void TypeInfo::AddAnimatablePropertyComponent( const std::string& name, Property
     if ( iter == mRegisteredProperties.end() )
     {
       mRegisteredProperties.push_back( RegisteredPropertyPair( index, RegisteredProperty( type, name, baseIndex, componentIndex ) ) );
+      mPropertyNameLookupValid = false;
       success = true;
     }
   }
@@ -623,38 +628,42 @@ uint32_t TypeInfo::GetPropertyCount() const
 Property::Index TypeInfo::GetPropertyIndex( const std::string& name ) const
 {
   Property::Index index = Property::INVALID_INDEX;
-  bool found = false;
 
-  // check default properties
-  if( mDefaultProperties )
+  // check default and registered properties
+  const PropertyNameLookup& lookup = GetPropertyNameLookup();
+  const auto iter = lookup.find( name );
+  if( iter != lookup.end() )
   {
-    for( Property::Index tableIndex = 0; tableIndex < mDefaultPropertyCount; ++tableIndex )
-    {
-      if( 0 == name.compare( mDefaultProperties[ tableIndex ].name ) )
-      {
-        index = mDefaultProperties[ tableIndex ].enumIndex;
-        found = true;
-        break;
-      }
-    }
+    index = iter->second;
   }
-  if( !found )
+  else if( GetBaseType( mBaseType, mTypeRegistry, mBaseTypeName ) )
   {
-    // Slow but should not be done that often
-    RegisteredPropertyContainer::const_iterator iter = find_if( mRegisteredProperties.begin(), mRegisteredProperties.end(),
-                                                            PropertyNameFinder< RegisteredPropertyPair >( name ) );
-    if ( iter != mRegisteredProperties.end() )
+    // call base type recursively
+    index = mBaseType->GetPropertyIndex( name );
+  }
+
+  return index;
+}
+
+const TypeInfo::PropertyNameLookup& TypeInfo::GetPropertyNameLookup() const
+{
+  if( !mPropertyNameLookupValid )
+  {
+    mPropertyNameLookup.clear();
+    mPropertyNameLookup.reserve( mDefaultPropertyCount + mRegisteredProperties.size() );
+
+    // The first property with a name wins; default properties are searched before the registered ones
+    for( Property::Index tableIndex = 0; tableIndex < mDefaultPropertyCount; ++tableIndex )
     {
-      index = iter->first;
+      mPropertyNameLookup.emplace( mDefaultProperties[ tableIndex ].name, mDefaultProperties[ tableIndex ].enumIndex );
     }
-    else if( GetBaseType( mBaseType, mTypeRegistry, mBaseTypeName ) )
+    for( auto&& elem : mRegisteredProperties )
     {
-      // call base type recursively
-      index = mBaseType->GetPropertyIndex( name );
+      mPropertyNameLookup.emplace( elem.second.name, elem.first );
     }
+    mPropertyNameLookupValid = true;
   }
-
-  return index;
+  return mPropertyNameLookup;
 }
 
 Property::Index TypeInfo::GetBasePropertyIndex( Property::Index index ) const
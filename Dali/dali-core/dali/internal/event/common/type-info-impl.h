@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/object/base-handle.h>
@@ -393,6 +394,7 @@ private:
   typedef std::vector< ConnectionPair > ConnectorContainer;
   typedef std::vector< RegisteredPropertyPair > RegisteredPropertyContainer;
   typedef std::vector< PropertyDefaultValuePair > PropertyDefaultValueContainer;
+  typedef std::unordered_map< std::string, Property::Index > PropertyNameLookup;
 
   /**
    * Append properties from registeredProperties onto indices.
@@ -402,6 +404,13 @@ private:
   void AppendProperties( Dali::Property::IndexContainer& indices,
                          const TypeInfo::RegisteredPropertyContainer& registeredProperties ) const;
 
+  /**
+   * Retrieve the lookup from the names of the default and registered properties of this type to their indices.
+   * The lookup is built on first use and rebuilt after a property is registered.
+   * @return The property name lookup
+   */
+  const PropertyNameLookup& GetPropertyNameLookup() const;
+
 private:
 
   TypeRegistry& mTypeRegistry;
@@ -418,9 +427,11 @@ private:
   RegisteredPropertyContainer mRegisteredProperties;
   RegisteredPropertyContainer mRegisteredChildProperties;
   PropertyDefaultValueContainer mPropertyDefaultValues;
+  mutable PropertyNameLookup mPropertyNameLookup; ///< Names of the default and registered properties of this type
   const Dali::PropertyDetails* mDefaultProperties = nullptr;
   Property::Index mDefaultPropertyCount = 0;
   bool mCSharpType = false;    ///< Whether this type info is for a CSharp control (instead of C++)
+  mutable bool mPropertyNameLookupValid = false; ///< Whether mPropertyNameLookup holds all the properties of this type
 };
 
 } // namespace Internal
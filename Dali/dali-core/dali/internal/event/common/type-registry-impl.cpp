@@ -58,19 +58,16 @@ TypeRegistry::TypeRegistry()
 
 TypeRegistry::~TypeRegistry()
 {
+  mRegistryIndex.clear();
   mRegistryLut.clear();
 }
 
 TypeRegistry::TypeInfoPointer TypeRegistry::GetTypeInfo( const std::string& uniqueTypeName )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( uniqueTypeName );
+  if( typeInfo )
   {
-    // Note! mRegistryLut contains Dali::TypeInfo handles, so cannot call GetTypeName()
-    // as it calls us back resulting in infinite loop (GetTypeName is in BaseHandle part)
-    if( iter->GetName() == uniqueTypeName )
-    {
-      return iter;
-    }
+    return TypeInfoPointer( typeInfo );
   }
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Cannot find requested type '%s'\n", uniqueTypeName.c_str() );
 
@@ -125,16 +122,14 @@ std::string TypeRegistry::Register( const std::string& uniqueTypeName, const std
   std::string baseTypeName = DemangleClassName( baseTypeInfo.name() );
 
   // check for duplicates using uniqueTypeName
-  for( auto&& iter : mRegistryLut )
+  if( FindTypeInfo( uniqueTypeName ) )
   {
-    if( iter->GetName() == uniqueTypeName )
-    {
-      DALI_LOG_WARNING( "Duplicate name in TypeRegistry for '%s'\n", + uniqueTypeName.c_str() );
-      DALI_ASSERT_ALWAYS( !"Duplicate type name in Type Registration" );
-      return uniqueTypeName; // never actually happening due to the assert
-    }
+    DALI_LOG_WARNING( "Duplicate name in TypeRegistry for '%s'\n", + uniqueTypeName.c_str() );
+    DALI_ASSERT_ALWAYS( !"Duplicate type name in Type Registration" );
+    return uniqueTypeName; // never actually happening due to the assert
   }
 
+  mRegistryIndex[ uniqueTypeName ] = static_cast<uint32_t>( mRegistryLut.size() );
   mRegistryLut.push_back( TypeRegistry::TypeInfoPointer( new Internal::TypeInfo( uniqueTypeName, baseTypeName, createInstance, defaultProperties, defaultPropertyCount ) ) );
   DALI_LOG_INFO( gLogFilter, Debug::Concise, "Type Registration %s(%s)\n", uniqueTypeName.c_str(), baseTypeName.c_str() );
 
@@ -152,16 +147,14 @@ void TypeRegistry::Register( const std::string& uniqueTypeName, const std::type_
   std::string baseTypeName = DemangleClassName( baseTypeInfo.name() );
 
   // check for duplicates using uniqueTypeName
-  for( auto&& iter : mRegistryLut )
+  if( FindTypeInfo( uniqueTypeName ) )
   {
-    if( iter->GetName() == uniqueTypeName )
-    {
-      DALI_LOG_WARNING( "Duplicate name in TypeRegistry for '%s'\n", + uniqueTypeName.c_str() );
-      DALI_ASSERT_ALWAYS( !"Duplicate type name in Type Registration" );
-      return; // never actually happening due to the assert
-    }
+    DALI_LOG_WARNING( "Duplicate name in TypeRegistry for '%s'\n", + uniqueTypeName.c_str() );
+    DALI_ASSERT_ALWAYS( !"Duplicate type name in Type Registration" );
+    return; // never actually happening due to the assert
   }
 
+  mRegistryIndex[ uniqueTypeName ] = static_cast<uint32_t>( mRegistryLut.size() );
   mRegistryLut.push_back( TypeRegistry::TypeInfoPointer( new Internal::TypeInfo( uniqueTypeName, baseTypeName, createInstance ) ) );
   DALI_LOG_INFO( gLogFilter, Debug::Concise, "Type Registration %s(%s)\n", uniqueTypeName.c_str(), baseTypeName.c_str() );
 }
@@ -181,38 +174,31 @@ std::string TypeRegistry::RegistrationName( const std::type_info& registerType )
 
 void TypeRegistry::RegisterSignal( TypeRegistration& typeRegistration, const std::string& name, Dali::TypeInfo::SignalConnectorFunction func )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddConnectorFunction( name, func );
-      break;
-    }
+    typeInfo->AddConnectorFunction( name, func );
   }
 }
 
 bool TypeRegistry::RegisterAction( TypeRegistration& typeRegistration, const std::string &name, Dali::TypeInfo::ActionFunction f )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddActionFunction( name, f );
-      return true;
-    }
+    typeInfo->AddActionFunction( name, f );
+    return true;
   }
   return false;
 }
 
 bool TypeRegistry::RegisterProperty( TypeRegistration& typeRegistration, const std::string& name, Property::Index index, Property::Type type, Dali::TypeInfo::SetPropertyFunction setFunc, Dali::TypeInfo::GetPropertyFunction getFunc )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddProperty( name, index, type, setFunc, getFunc );
-      return true;
-    }
+    typeInfo->AddProperty( name, index, type, setFunc, getFunc );
+    return true;
   }
 
   return false;
@@ -220,13 +206,11 @@ bool TypeRegistry::RegisterProperty( TypeRegistration& typeRegistration, const s
 
 bool TypeRegistry::RegisterProperty( const std::string& objectName, const std::string& name, Property::Index index, Property::Type type, Dali::CSharpTypeInfo::SetPropertyFunction setFunc, Dali::CSharpTypeInfo::GetPropertyFunction getFunc )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( objectName );
+  if( typeInfo )
   {
-    if( iter->GetName() == objectName )
-    {
-      iter->AddProperty( name, index, type, setFunc, getFunc );
-      return true;
-    }
+    typeInfo->AddProperty( name, index, type, setFunc, getFunc );
+    return true;
   }
 
   return false;
@@ -235,13 +219,11 @@ bool TypeRegistry::RegisterProperty( const std::string& objectName, const std::s
 
 bool TypeRegistry::RegisterAnimatableProperty( TypeRegistration& typeRegistration, const std::string& name, Property::Index index, Property::Type type )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddAnimatableProperty( name, index, type );
-      return true;
-    }
+    typeInfo->AddAnimatableProperty( name, index, type );
+    return true;
   }
 
   return false;
@@ -249,13 +231,11 @@ bool TypeRegistry::RegisterAnimatableProperty( TypeRegistration& typeRegistratio
 
 bool TypeRegistry::RegisterAnimatableProperty( TypeRegistration& typeRegistration, const std::string& name, Property::Index index, const Property::Value& value )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddAnimatableProperty( name, index, value );
-      return true;
-    }
+    typeInfo->AddAnimatableProperty( name, index, value );
+    return true;
   }
 
   return false;
@@ -263,13 +243,11 @@ bool TypeRegistry::RegisterAnimatableProperty( TypeRegistration& typeRegistratio
 
 bool TypeRegistry::RegisterAnimatablePropertyComponent( TypeRegistration& typeRegistration, const std::string& name, Property::Index index, Property::Index baseIndex, unsigned int componentIndex )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( typeRegistration.RegisteredName() );
+  if( typeInfo )
   {
-    if( iter->GetName() == typeRegistration.RegisteredName() )
-    {
-      iter->AddAnimatablePropertyComponent( name, index, baseIndex, componentIndex );
-      return true;
-    }
+    typeInfo->AddAnimatablePropertyComponent( name, index, baseIndex, componentIndex );
+    return true;
   }
 
   return false;
@@ -277,13 +255,11 @@ bool TypeRegistry::RegisterAnimatablePropertyComponent( TypeRegistration& typeRe
 
 bool TypeRegistry::RegisterChildProperty( const std::string& registeredType, const std::string& name, Property::Index index, Property::Type type )
 {
-  for( auto&& iter : mRegistryLut )
+  TypeInfo* typeInfo = FindTypeInfo( registeredType );
+  if( typeInfo )
   {
-    if( iter->GetName() == registeredType )
-    {
-      iter->AddChildProperty( name, index, type );
-      return true;
-    }
+    typeInfo->AddChildProperty( name, index, type );
+    return true;
   }
 
   return false;
@@ -356,6 +332,18 @@ TypeRegistry::TypeInfoPointer TypeRegistry::GetTypeInfo(const Dali::BaseObject *
   return type;
 }
 
+TypeInfo* TypeRegistry::FindTypeInfo( const std::string& uniqueTypeName ) const
+{
+  // Note! The TypeInfo name is used rather than the handle's GetTypeName(),
+  // as that calls us back resulting in infinite loop (GetTypeName is in BaseHandle part)
+  const auto iter = mRegistryIndex.find( uniqueTypeName );
+  if( iter != mRegistryIndex.end() )
+  {
+    return mRegistryLut[ iter->second ].Get();
+  }
+  return nullptr;
+}
+
 } // namespace Internal
 
 } // namespace Dali
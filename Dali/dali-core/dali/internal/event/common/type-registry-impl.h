@@ -18,6 +18,10 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <string>
+#include <unordered_map>
+
 // INTERNAL INCLUDES
 #include <dali/devel-api/object/csharp-type-info.h>
 #include <dali/public-api/object/type-registry.h>
@@ -242,12 +246,26 @@ public:
    */
   static std::string RegistrationName( const std::type_info& registerType );
 
+private:
+
+  /**
+   * Finds a registered type by name.
+   * @param[in] uniqueTypeName The name of the type
+   * @return The type info, or nullptr if the type is not registered
+   */
+  TypeInfo* FindTypeInfo( const std::string& uniqueTypeName ) const;
+
 private:
   /*
    * Mapping from type name to TypeInfo
    */
   std::vector< TypeInfoPointer > mRegistryLut;
 
+  /*
+   * Mapping from type name to the position of its TypeInfo in mRegistryLut
+   */
+  std::unordered_map< std::string, uint32_t > mRegistryIndex;
+
   std::vector< Dali::TypeInfo::CreateFunction > mInitFunctions;
 
 private:
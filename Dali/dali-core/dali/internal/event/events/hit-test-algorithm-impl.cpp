@@ -169,6 +169,14 @@ HitActor HitTestWithinLayer( Actor& actor,
     return hit;
   }
 
+  // If the ray misses the bounding sphere of the actor and its descendants, it misses the sphere of each of them,
+  // so none of them can be hit. The sphere is from the last completed update, so an actor that has moved since
+  // can be missed until the next one
+  if( !actor.RaySubtreeSphereTest( rayOrigin, rayDir ) )
+  {
+    return hit;
+  }
+
   // For clipping, regardless of whether we have hit this actor or not,
   // we increase the clipping depth if we have hit a clipping actor.
   // This is used later to ensure all nested clipped children have hit
@@ -18,12 +18,16 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-algorithms.h>
 
+// EXTERNAL INCLUDES
+#include <cstring> // memcpy
+
 // INTERNAL INCLUDES
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/render-instruction.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/renderers/render-renderer.h>
+#include <dali/internal/render/shaders/program.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 
 using Dali::Internal::SceneGraph::RenderItem;
@@ -55,6 +59,9 @@ const int DaliStencilFunctionToGL[]  = { GL_NEVER, GL_LESS, GL_EQUAL, GL_LEQUAL,
 // Note: These MUST be in the same order as Dali::StencilOperation enum.
 const int DaliStencilOperationToGL[] = { GL_ZERO, GL_KEEP, GL_REPLACE, GL_INCR, GL_DECR, GL_INVERT, GL_INCR_WRAP, GL_DECR_WRAP };
 
+const uint32_t UNIFORM_BUFFER_COUNT = 3u;                   ///< Number of uniform buffers used in turn by the render-lists
+const uint32_t INVALID_UNIFORM_BLOCK_OFFSET = 0xFFFFFFFF;   ///< Marks a render item which does not use the uniform blocks
+
 /**
  * @brief Find the intersection of two AABB rectangles.
  * This is a logical AND operation. IE. The intersection is the area overlapped by both rectangles.
@@ -404,6 +411,11 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
   uint32_t lastClippingId( 0u );
   bool usedStencilBuffer( false );
   bool firstDepthBufferUse( true );
+  const bool instancingAvailable( context.CachedGlesVersion() >= 30 );
+
+  // On OpenGL ES 3.0, the camera and per-item uniforms of the shaders which declare the uniform blocks are uploaded at once
+  const bool useUniformBlocks = ( context.CachedUniformBufferOffsetAlignment() > 0u ) &&
+                                WriteUniformBlocks( renderList, context, bufferIndex, viewMatrix, projectionMatrix );
   mViewportRectangle = context.GetViewport();
   mHasLayerScissor = false;
 
@@ -412,11 +424,23 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
   if( renderList.IsClipping() )
   {
     context.SetScissorTest( true );
-    const ClippingBox& layerScissorBox = renderList.GetClippingBox();
+    ClippingBox layerScissorBox = renderList.GetClippingBox();
+    if( !mDamagedRectangle.IsEmpty() )
+    {
+      layerScissorBox = IntersectAABB( layerScissorBox, mDamagedRectangle );
+    }
     context.Scissor( layerScissorBox.x, layerScissorBox.y, layerScissorBox.width, layerScissorBox.height );
     mScissorStack.push_back( layerScissorBox );
     mHasLayerScissor = true;
   }
+  else if( !mDamagedRectangle.IsEmpty() )
+  {
+    // Partial update; only the damaged area is redrawn, so it is treated like a layer scissor box.
+    context.SetScissorTest( true );
+    context.Scissor( mDamagedRectangle.x, mDamagedRectangle.y, mDamagedRectangle.width, mDamagedRectangle.height );
+    mScissorStack.push_back( mDamagedRectangle );
+    mHasLayerScissor = true;
+  }
   else
   {
     // We are not performing a layer clip. Add the viewport as the root scissor rectangle.
@@ -446,17 +470,147 @@ inline void RenderAlgorithms::ProcessRenderList( const RenderList& renderList,
         SetupDepthBuffer( item, context, autoDepthTestMode, firstDepthBufferUse );
       }
 
-      // Render the item.
-      item.mRenderer->Render( context, bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix,
-                              viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque, boundTextures );
+      if( useUniformBlocks && mUniformBlockOffsets[ index ] != INVALID_UNIFORM_BLOCK_OFFSET )
+      {
+        mUniformBuffers[ mUniformBufferIndex ]->BindUniformRange( context, Program::UNIFORM_BLOCK_ITEM, mUniformBlockOffsets[ index ], Program::ITEM_UNIFORM_BLOCK_SIZE );
+      }
+
+      // A shader which supports instancing reads the matrix and the color from the instance attributes, so its items
+      // are always drawn by RenderInstances(); a run of compatible items is drawn with one instanced draw call.
+      // The following items of the run share the clipping and depth state of this item, so it does not need to be set up again.
+      if( item.mRenderer->IsInstancingSupported() )
+      {
+        const uint32_t instanceCount = instancingAvailable ? GetInstanceRunLength( renderList, index, bufferIndex ) : 1u;
+        item.mRenderer->RenderInstances( context, bufferIndex, renderList, index, instanceCount, viewMatrix, projectionMatrix,
+                                         !item.mIsOpaque, boundTextures, mInstanceBuffer, mInstanceData );
+        index += instanceCount - 1u;
+      }
+      else
+      {
+        // Render the item.
+        item.mRenderer->Render( context, bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix,
+                                viewMatrix, projectionMatrix, item.mSize, !item.mIsOpaque, boundTextures );
+      }
+    }
+  }
+}
+
+inline bool RenderAlgorithms::WriteUniformBlocks( const RenderList& renderList,
+                                                  Context& context,
+                                                  BufferIndex bufferIndex,
+                                                  const Matrix& viewMatrix,
+                                                  const Matrix& projectionMatrix )
+{
+  // Each block must start at a multiple of the offset alignment; the camera block comes first
+  const uint32_t alignment = context.CachedUniformBufferOffsetAlignment();
+  const uint32_t cameraBlockStride = ( ( Program::CAMERA_UNIFORM_BLOCK_SIZE + alignment - 1u ) / alignment ) * alignment;
+  const uint32_t itemBlockStride = ( ( Program::ITEM_UNIFORM_BLOCK_SIZE + alignment - 1u ) / alignment ) * alignment;
+
+  const uint32_t count = static_cast<uint32_t>( renderList.Count() );
+  mUniformBlockOffsets.Resize( count );
+  uint32_t size = cameraBlockStride;
+  for( uint32_t index = 0u; index < count; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    if( item.mRenderer && item.mRenderer->IsUniformBlockSupported() )
+    {
+      mUniformBlockOffsets[ index ] = size;
+      size += itemBlockStride;
+    }
+    else
+    {
+      mUniformBlockOffsets[ index ] = INVALID_UNIFORM_BLOCK_OFFSET;
+    }
+  }
+
+  if( size == cameraBlockStride )
+  {
+    // No shader uses the uniform blocks
+    return false;
+  }
+
+  mUniformBlockData.Resize( size );
+  float* cameraBlock = reinterpret_cast< float* >( mUniformBlockData.Begin() );
+  memcpy( cameraBlock, viewMatrix.AsFloat(), 16u * sizeof( float ) );
+  memcpy( cameraBlock + 16u, projectionMatrix.AsFloat(), 16u * sizeof( float ) );
+
+  for( uint32_t index = 0u; index < count; ++index )
+  {
+    const uint32_t offset = mUniformBlockOffsets[ index ];
+    if( offset != INVALID_UNIFORM_BLOCK_OFFSET )
+    {
+      const RenderItem& item = renderList.GetItem( index );
+      item.mRenderer->WriteUniformBlock( bufferIndex, *item.mNode, item.mModelMatrix, item.mModelViewMatrix, projectionMatrix, item.mSize,
+                                         reinterpret_cast< float* >( mUniformBlockData.Begin() + offset ) );
     }
   }
+
+  mUniformBufferIndex = ( mUniformBufferIndex + 1u ) % UNIFORM_BUFFER_COUNT;
+  GpuBuffer& uniformBuffer = *mUniformBuffers[ mUniformBufferIndex ];
+  uniformBuffer.UpdateDataBuffer( context, static_cast<GLsizeiptr>( size ), mUniformBlockData.Begin(), GpuBuffer::STREAM_DRAW, GpuBuffer::UNIFORM_BUFFER );
+  uniformBuffer.BindUniformRange( context, Program::UNIFORM_BLOCK_CAMERA, 0, Program::CAMERA_UNIFORM_BLOCK_SIZE );
+
+  return true;
 }
 
-RenderAlgorithms::RenderAlgorithms()
+inline uint32_t RenderAlgorithms::GetInstanceRunLength( const RenderList& renderList, uint32_t firstIndex, BufferIndex bufferIndex )
+{
+  const RenderItem& firstItem = renderList.GetItem( firstIndex );
+  const SceneGraph::Node& firstNode = *firstItem.mNode;
+
+  // Clipping nodes change the stencil or scissor state, and node uniforms are set per item
+  if( firstNode.GetClippingMode() != ClippingMode::DISABLED ||
+      static_cast< const SceneGraph::NodeDataProvider& >( firstNode ).GetUniformMap( bufferIndex ).Count() != 0u )
+  {
+    return 1u;
+  }
+
+  const uint32_t count = static_cast<uint32_t>( renderList.Count() );
+  uint32_t index = firstIndex + 1u;
+  for( ; index < count; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+    const SceneGraph::Node& node = *item.mNode;
+    if( !item.mRenderer ||
+        item.mIsOpaque != firstItem.mIsOpaque ||
+        node.GetClippingMode() != ClippingMode::DISABLED ||
+        node.GetClippingId() != firstNode.GetClippingId() ||
+        node.GetClippingDepth() != firstNode.GetClippingDepth() ||
+        node.GetScissorDepth() != firstNode.GetScissorDepth() ||
+        static_cast< const SceneGraph::NodeDataProvider& >( node ).GetUniformMap( bufferIndex ).Count() != 0u ||
+        !firstItem.mRenderer->CanBeInstancedWith( bufferIndex, *item.mRenderer ) )
+    {
+      break;
+    }
+  }
+
+  return index - firstIndex;
+}
+
+RenderAlgorithms::RenderAlgorithms( Context& context )
   : mViewportRectangle(),
+    mDamagedRectangle(),
+    mInstanceBuffer( context ),
+    mInstanceData(),
+    mUniformBuffers(),
+    mUniformBlockData(),
+    mUniformBlockOffsets(),
+    mUniformBufferIndex( 0u ),
     mHasLayerScissor( false )
 {
+  for( uint32_t i = 0u; i < UNIFORM_BUFFER_COUNT; ++i )
+  {
+    mUniformBuffers.PushBack( new GpuBuffer( context ) );
+  }
+}
+
+void RenderAlgorithms::GlContextDestroyed()
+{
+  mInstanceBuffer.GlContextDestroyed();
+  for( auto&& uniformBuffer : mUniformBuffers )
+  {
+    uniformBuffer->GlContextDestroyed();
+  }
 }
 
 void RenderAlgorithms::ProcessRenderInstruction( const RenderInstruction& instruction,
@@ -464,10 +618,13 @@ void RenderAlgorithms::ProcessRenderInstruction( const RenderInstruction& instru
                                                  BufferIndex bufferIndex,
                                                  Integration::DepthBufferAvailable depthBufferAvailable,
                                                  Integration::StencilBufferAvailable stencilBufferAvailable,
-                                                 Vector<GLuint>& boundTextures )
+                                                 Vector<GLuint>& boundTextures,
+                                                 const ClippingBox& damagedRect )
 {
   DALI_PRINT_RENDER_INSTRUCTION( instruction, bufferIndex );
 
+  mDamagedRectangle = damagedRect;
+
   const Matrix* viewMatrix       = instruction.GetViewMatrix( bufferIndex );
   const Matrix* projectionMatrix = instruction.GetProjectionMatrix( bufferIndex );
 
@@ -20,8 +20,10 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/core-enumerations.h>
+#include <dali/devel-api/common/owner-container.h>
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/render/common/render-list.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
 
 namespace Dali
 {
@@ -48,8 +50,14 @@ class RenderAlgorithms
 
     /**
      * Constructor.
+     * @param[in] context The GL context owning the buffers used for instanced drawing and uniform blocks
      */
-    RenderAlgorithms();
+    RenderAlgorithms( Context& context );
+
+    /**
+     * Called when the GL context has been destroyed.
+     */
+    void GlContextDestroyed();
 
     /**
      * Process a render-instruction.
@@ -59,13 +67,15 @@ class RenderAlgorithms
      * @param[in] depthBufferAvailable   Whether the depth buffer is available
      * @param[in] stencilBufferAvailable Whether the stencil buffer is available
      * @param[in] boundTextures          The textures bound for rendering
+     * @param[in] damagedRect            The area of the viewport to redraw in a partial update, or an empty rectangle to redraw the whole viewport
      */
     void ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
                                    Context& context,
                                    BufferIndex bufferIndex,
                                    Integration::DepthBufferAvailable depthBufferAvailable,
                                    Integration::StencilBufferAvailable stencilBufferAvailable,
-                                   Vector<GLuint>& boundTextures );
+                                   Vector<GLuint>& boundTextures,
+                                   const Dali::ClippingBox& damagedRect );
 
   private:
 
@@ -106,6 +116,32 @@ class RenderAlgorithms
                                uint32_t& lastClippingId,
                                Integration::StencilBufferAvailable stencilBufferAvailable );
 
+    /**
+     * @brief Count the render items, starting at the given one, which can be drawn with a single instanced draw call.
+     * The items must be consecutive, use compatible renderers and share the same clipping state.
+     * @param[in] renderList  The render-list containing the items
+     * @param[in] firstIndex  The index of the first item of the run
+     * @param[in] bufferIndex The current render buffer index (previous update buffer)
+     * @return                The number of items in the run, at least 1
+     */
+    inline uint32_t GetInstanceRunLength( const Dali::Internal::SceneGraph::RenderList& renderList, uint32_t firstIndex, BufferIndex bufferIndex );
+
+    /**
+     * @brief Write the uniform blocks of the camera and of the render items whose shaders use them, and upload them in one buffer.
+     * The buffers are used in turn, so a buffer is not overwritten while the GPU may still read it for the previous render-list.
+     * @param[in] renderList       The render-list to process
+     * @param[in] context          The GL context
+     * @param[in] bufferIndex      The current render buffer index (previous update buffer)
+     * @param[in] viewMatrix       The view matrix from the appropriate camera
+     * @param[in] projectionMatrix The projection matrix from the appropriate camera
+     * @return                     True if any render item uses the uniform blocks
+     */
+    inline bool WriteUniformBlocks( const Dali::Internal::SceneGraph::RenderList& renderList,
+                                    Context& context,
+                                    BufferIndex bufferIndex,
+                                    const Matrix& viewMatrix,
+                                    const Matrix& projectionMatrix );
+
     /**
      * @brief Process a render-list.
      * @param[in] renderList             The render-list to process.
@@ -137,6 +173,13 @@ class RenderAlgorithms
 
     ScissorStackType                        mScissorStack;        ///< Contains the currently applied scissor hierarchy (so we can undo clips)
     Dali::ClippingBox                       mViewportRectangle;   ///< The viewport dimensions, used to translate AABBs to scissor coordinates
+    Dali::ClippingBox                       mDamagedRectangle;    ///< The area of the viewport to redraw, empty if the whole viewport is redrawn
+    GpuBuffer                               mInstanceBuffer;      ///< The buffer holding the per-instance data of an instanced draw call
+    Vector<float>                           mInstanceData;        ///< Scratch memory used to build the per-instance data
+    OwnerContainer< GpuBuffer* >            mUniformBuffers;      ///< Ring of buffers holding the uniform blocks of a render-list
+    Vector<uint8_t>                         mUniformBlockData;    ///< Scratch memory used to build the uniform blocks
+    Vector<uint32_t>                        mUniformBlockOffsets; ///< Offset of the uniform block of each render item, or INVALID_UNIFORM_BLOCK_OFFSET
+    uint32_t                                mUniformBufferIndex;  ///< The buffer of the ring used by the current render-list
     bool                                    mHasLayerScissor:1;   ///< Marks if the currently process render instruction has a layer-based clipping region
 };
 
@@ -18,7 +18,12 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-item.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <limits>
+
 // INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
 #include <dali/internal/common/memory-pool-object-allocator.h>
 #include <dali/internal/render/renderers/render-renderer.h>
 #include <dali/internal/common/math.h>
@@ -50,7 +55,8 @@ RenderItem::RenderItem()
   mNode( NULL ),
   mTextureSet( NULL ),
   mDepthIndex( 0 ),
-  mIsOpaque( true )
+  mIsOpaque( true ),
+  mUpdated( true )
 {
 }
 
@@ -116,6 +122,56 @@ ClippingBox RenderItem::CalculateViewportSpaceAABB( const int viewportWidth, con
   return ClippingBox( x, y, z - x, w - y );
 }
 
+ClippingBox RenderItem::CalculateProjectedViewportSpaceAABB( const Matrix& projectionMatrix, const int viewportWidth, const int viewportHeight ) const
+{
+  Matrix modelViewProjectionMatrix( false );
+  Matrix::Multiply( modelViewProjectionMatrix, mModelViewMatrix, projectionMatrix );
+
+  const float halfActorX = mSize.x * 0.5f;
+  const float halfActorY = mSize.y * 0.5f;
+  const Vector4 corners[4]{ Vector4( -halfActorX, -halfActorY, 0.0f, 1.0f ),
+                            Vector4(  halfActorX, -halfActorY, 0.0f, 1.0f ),
+                            Vector4(  halfActorX,  halfActorY, 0.0f, 1.0f ),
+                            Vector4( -halfActorX,  halfActorY, 0.0f, 1.0f ) };
+
+  Vector2 aabbMin( std::numeric_limits<float>::max(), std::numeric_limits<float>::max() );
+  Vector2 aabbMax( -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() );
+  for( auto&& corner : corners )
+  {
+    const Vector4 position = modelViewProjectionMatrix * corner;
+    if( position.w <= Math::MACHINE_EPSILON_1 )
+    {
+      // The corner is behind the camera
+      return ClippingBox( 0, 0, viewportWidth, viewportHeight );
+    }
+
+    // Normalized device coordinates
+    const float x = position.x / position.w;
+    const float y = position.y / position.w;
+    aabbMin.x = std::min( aabbMin.x, x );
+    aabbMin.y = std::min( aabbMin.y, y );
+    aabbMax.x = std::max( aabbMax.x, x );
+    aabbMax.y = std::max( aabbMax.y, y );
+  }
+
+  // Anything outside the viewport is not visible; clamping also keeps the conversion below within the integer range.
+  aabbMin.x = Clamp( aabbMin.x, -1.0f, 1.0f );
+  aabbMin.y = Clamp( aabbMin.y, -1.0f, 1.0f );
+  aabbMax.x = Clamp( aabbMax.x, -1.0f, 1.0f );
+  aabbMax.y = Clamp( aabbMax.y, -1.0f, 1.0f );
+
+  // Convert to viewport pixels (origin at the bottom-left), rounding outwards so partially covered pixels are included.
+  const float halfViewportWidth  = static_cast<float>( viewportWidth )  * 0.5f;
+  const float halfViewportHeight = static_cast<float>( viewportHeight ) * 0.5f;
+
+  int x = static_cast< int >( floorf( ( aabbMin.x + 1.0f ) * halfViewportWidth ) );
+  int y = static_cast< int >( floorf( ( aabbMin.y + 1.0f ) * halfViewportHeight ) );
+  int z = static_cast< int >( ceilf( ( aabbMax.x + 1.0f ) * halfViewportWidth ) );
+  int w = static_cast< int >( ceilf( ( aabbMax.y + 1.0f ) * halfViewportHeight ) );
+
+  return ClippingBox( x, y, z - x, w - y );
+}
+
 void RenderItem::operator delete( void* ptr )
 {
   gRenderItemPool.Free( static_cast<RenderItem*>( ptr ) );
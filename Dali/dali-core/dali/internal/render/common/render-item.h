@@ -69,6 +69,20 @@ struct RenderItem
    */
   ClippingBox CalculateViewportSpaceAABB( const int viewportWidth, const int viewportHeight ) const;
 
+  /**
+   * @brief Calculates a viewport-space AABB using the full model-view-projection transform.
+   *
+   * Unlike CalculateViewportSpaceAABB this also handles perspective and rotations on the X & Y axis, so it can be used
+   * to find the area of the surface which is affected by this item (e.g. for partial updates).
+   * If any corner of the item lies behind the camera the projected area is unbounded, so the whole viewport is returned.
+   *
+   * @param[in]    projectionMatrix  The projection matrix of the camera used to render the item
+   * @param[in]    viewportWidth     The width of the viewport to calculate for
+   * @param[in]    viewportHeight    The height of the viewport to calculate for
+   * @return                         The AABB coordinates in viewport-space (x, y, width, height)
+   */
+  ClippingBox CalculateProjectedViewportSpaceAABB( const Matrix& projectionMatrix, const int viewportWidth, const int viewportHeight ) const;
+
   /**
    * Overriden delete operator.
    * Deletes the RenderItem from its global memory pool
@@ -84,6 +98,7 @@ struct RenderItem
   const void*       mTextureSet;        //< Used for sorting only
   int               mDepthIndex;
   bool              mIsOpaque:1;
+  bool              mUpdated:1;         //< True if anything affecting the rendered output of the item changed in this frame
 
 private:
 
@@ -63,6 +63,8 @@ public:
   : mNextFree( 0 ),
     mClippingBox( NULL ),
     mSourceLayer( NULL ),
+    mSourceRenderableCount( 0u ),
+    mSourceChecksum( 0u ),
     mHasColorRenderItems( false )
   {
   }
@@ -240,6 +242,35 @@ public:
     mSourceLayer = layer;
   }
 
+  /**
+   * Record the renderables the items of this list were built from.
+   * Culled or skipped renderables do not produce an item, so the item count alone cannot tell
+   * whether the list can be reused in a later frame.
+   * @param[in] count The number of renderables the list was built from
+   * @param[in] checksum The combined sum of the renderer and node addresses of those renderables
+   */
+  void SetSourceRenderables( uint32_t count, std::size_t checksum )
+  {
+    mSourceRenderableCount = count;
+    mSourceChecksum = checksum;
+  }
+
+  /**
+   * @return The number of renderables the items were built from
+   */
+  uint32_t GetSourceRenderableCount() const
+  {
+    return mSourceRenderableCount;
+  }
+
+  /**
+   * @return The combined sum of the renderer and node addresses the items were built from
+   */
+  std::size_t GetSourceChecksum() const
+  {
+    return mSourceChecksum;
+  }
+
   /**
    * Set if the RenderList contains color RenderItems
    * @param[in] hasColorRenderItems True if it contains color RenderItems, false otherwise
@@ -271,6 +302,8 @@ private:
 
   ClippingBox* mClippingBox;               ///< The clipping box, in window coordinates, when clipping is enabled
   Layer*       mSourceLayer;              ///< The originating layer where the renderers are from
+  uint32_t     mSourceRenderableCount;    ///< The number of renderables the items were built from
+  std::size_t  mSourceChecksum;           ///< The combined sum of the renderer and node addresses the items were built from
   bool         mHasColorRenderItems : 1;  ///< True if list contains color render items
 
 };
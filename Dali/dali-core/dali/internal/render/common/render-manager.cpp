@@ -20,6 +20,9 @@
 
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <algorithm>
+#include <limits>
+#include <utility>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/sampling.h>
@@ -55,13 +58,55 @@ namespace Internal
 namespace SceneGraph
 {
 
-#if defined(DEBUG_ENABLED)
 namespace
 {
+#if defined(DEBUG_ENABLED)
 Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_RENDER_MANAGER" );
-} // unnamed namespace
 #endif
 
+/**
+ * Merges a rectangle into another, so the result bounds both; empty rectangles are ignored.
+ * @param[in,out] rect The rectangle to merge into
+ * @param[in] other The rectangle to merge
+ */
+inline void MergeRect( Rect<int32_t>& rect, const Rect<int32_t>& other )
+{
+  if( other.IsEmpty() )
+  {
+    return;
+  }
+
+  if( rect.IsEmpty() )
+  {
+    rect = other;
+    return;
+  }
+
+  const int32_t left   = std::min( rect.x, other.x );
+  const int32_t bottom = std::min( rect.y, other.y );
+  const int32_t right  = std::max( rect.x + rect.width, other.x + other.width );
+  const int32_t top    = std::max( rect.y + rect.height, other.y + other.height );
+  rect.Set( left, bottom, right - left, top - bottom );
+}
+
+/**
+ * Intersects two rectangles.
+ * @param[in] rectA The first rectangle
+ * @param[in] rectB The second rectangle
+ * @return The intersection, with zero width and height if the rectangles do not intersect
+ */
+inline Rect<int32_t> IntersectRect( const Rect<int32_t>& rectA, const Rect<int32_t>& rectB )
+{
+  Rect<int32_t> intersection;
+  intersection.x = std::max( rectA.x, rectB.x );
+  intersection.y = std::max( rectA.y, rectB.y );
+  intersection.width  = std::max( std::min( rectA.x + rectA.width,  rectB.x + rectB.width  ) - intersection.x, 0 );
+  intersection.height = std::max( std::min( rectA.y + rectA.height, rectB.y + rectB.height ) - intersection.y, 0 );
+  return intersection;
+}
+
+} // unnamed namespace
+
 /**
  * Structure to contain internal data
  */
@@ -71,7 +116,8 @@ struct RenderManager::Impl
         Integration::GlSyncAbstraction& glSyncAbstraction,
         Integration::GlContextHelperAbstraction& glContextHelperAbstraction,
         Integration::DepthBufferAvailable depthBufferAvailableParam,
-        Integration::StencilBufferAvailable stencilBufferAvailableParam )
+        Integration::StencilBufferAvailable stencilBufferAvailableParam,
+        Integration::PartialUpdateAvailable partialUpdateAvailableParam )
   : context( glAbstraction, &surfaceContextContainer ),
     currentContext( &context ),
     glAbstraction( glAbstraction ),
@@ -79,7 +125,7 @@ struct RenderManager::Impl
     glContextHelperAbstraction( glContextHelperAbstraction ),
     renderQueue(),
     instructions(),
-    renderAlgorithms(),
+    renderAlgorithms( context ),
     backgroundColor( Dali::Stage::DEFAULT_BACKGROUND_COLOR ),
     frameCount( 0u ),
     renderBufferIndex( SceneGraphBuffers::INITIAL_UPDATE_BUFFER_INDEX ),
@@ -89,9 +135,11 @@ struct RenderManager::Impl
     textureContainer(),
     frameBufferContainer(),
     lastFrameWasRendered( false ),
+    partialUpdatePossible( false ),
     programController( glAbstraction ),
     depthBufferAvailable( depthBufferAvailableParam ),
-    stencilBufferAvailable( stencilBufferAvailableParam )
+    stencilBufferAvailable( stencilBufferAvailableParam ),
+    partialUpdateAvailable( partialUpdateAvailableParam )
   {
      // Create thread pool with just one thread ( there may be a need to create more threads in the future ).
     threadPool = std::unique_ptr<Dali::ThreadPool>( new Dali::ThreadPool() );
@@ -163,6 +211,7 @@ struct RenderManager::Impl
   OwnerContainer< Render::Geometry* >       geometryContainer;       ///< List of owned Geometries
 
   bool                                      lastFrameWasRendered;    ///< Keeps track of the last frame being rendered due to having render instructions
+  bool                                      partialUpdatePossible;   ///< Whether the surfaces can be partially redrawn in the current frame
 
   OwnerContainer< Render::RenderTracker* >  mRenderTrackers;         ///< List of render trackers
 
@@ -170,24 +219,32 @@ struct RenderManager::Impl
 
   Integration::DepthBufferAvailable         depthBufferAvailable;     ///< Whether the depth buffer is available
   Integration::StencilBufferAvailable       stencilBufferAvailable;   ///< Whether the stencil buffer is available
+  Integration::PartialUpdateAvailable       partialUpdateAvailable;   ///< Whether the surfaces can be partially updated
 
   std::unique_ptr<Dali::ThreadPool>         threadPool;               ///< The thread pool
   Vector<GLuint>                            boundTextures;            ///< The textures bound for rendering
   Vector<GLuint>                            textureDependencyList;    ///< The dependency list of binded textures
+  Vector<Render::Texture*>                  updatedTextures;          ///< The textures uploaded since the last frame was rendered
+  Render::SurfaceFrameBuffer::ItemRectContainer itemRects;            ///< The areas covered by the render items of the current instruction
+  std::vector< std::pair< uint32_t, uint32_t > > itemOrders;           ///< The last draw order and the index of each item kept from the last frame, by draw order
+  std::vector< uint32_t >                   itemOrderRunTails;        ///< Scratch space to find the items still drawn in their last order
+  std::vector< uint32_t >                   itemOrderRunPrevious;     ///< Scratch space to find the items still drawn in their last order
 };
 
 RenderManager* RenderManager::New( Integration::GlAbstraction& glAbstraction,
                                    Integration::GlSyncAbstraction& glSyncAbstraction,
                                    Integration::GlContextHelperAbstraction& glContextHelperAbstraction,
                                    Integration::DepthBufferAvailable depthBufferAvailable,
-                                   Integration::StencilBufferAvailable stencilBufferAvailable )
+                                   Integration::StencilBufferAvailable stencilBufferAvailable,
+                                   Integration::PartialUpdateAvailable partialUpdateAvailable )
 {
   RenderManager* manager = new RenderManager;
   manager->mImpl = new Impl( glAbstraction,
                              glSyncAbstraction,
                              glContextHelperAbstraction,
                              depthBufferAvailable,
-                             stencilBufferAvailable );
+                             stencilBufferAvailable,
+                             partialUpdateAvailable );
   return manager;
 }
 
@@ -219,6 +276,7 @@ void RenderManager::ContextDestroyed()
 {
   mImpl->context.GlContextDestroyed();
   mImpl->programController.GlContextDestroyed();
+  mImpl->renderAlgorithms.GlContextDestroyed();
 
   //Inform textures
   for( auto&& texture : mImpl->textureContainer )
@@ -297,6 +355,12 @@ void RenderManager::RemoveTexture( Render::Texture* texture )
   {
     if ( iter == texture )
     {
+      auto updatedIter = std::find( mImpl->updatedTextures.Begin(), mImpl->updatedTextures.End(), texture );
+      if( updatedIter != mImpl->updatedTextures.End() )
+      {
+        mImpl->updatedTextures.Erase( updatedIter );
+      }
+
       texture->Destroy( mImpl->context );
       mImpl->textureContainer.Erase( &iter ); // Texture found; now destroy it
       return;
@@ -307,11 +371,13 @@ void RenderManager::RemoveTexture( Render::Texture* texture )
 void RenderManager::UploadTexture( Render::Texture* texture, PixelDataPtr pixelData, const Texture::UploadParams& params )
 {
   texture->Upload( mImpl->context, pixelData, params );
+  mImpl->updatedTextures.PushBack( texture );
 }
 
 void RenderManager::GenerateMipmaps( Render::Texture* texture )
 {
   texture->GenerateMipmaps( mImpl->context );
+  mImpl->updatedTextures.PushBack( texture );
 }
 
 void RenderManager::SetFilterMode( Render::Sampler* sampler, uint32_t minFilterMode, uint32_t magFilterMode )
@@ -544,6 +610,34 @@ void RenderManager::Render( Integration::RenderStatus& status, bool forceClear,
 
     if ( !uploadOnly )
     {
+      // A surface can only be partially redrawn if nothing else is rendered this frame;
+      // off-screen buffers and shared surfaces would need their own damage tracking.
+      mImpl->partialUpdatePossible = ( mImpl->partialUpdateAvailable == Integration::PartialUpdateAvailable::TRUE );
+      for( uint32_t i = 0; ( i < count ) && mImpl->partialUpdatePossible; ++i )
+      {
+        Render::FrameBuffer* frameBuffer = mImpl->instructions.At( mImpl->renderBufferIndex, i ).mFrameBuffer;
+        if( !frameBuffer || !frameBuffer->IsSurfaceBacked() )
+        {
+          mImpl->partialUpdatePossible = false;
+        }
+
+        for( uint32_t j = 0; ( j < i ) && mImpl->partialUpdatePossible; ++j )
+        {
+          if( mImpl->instructions.At( mImpl->renderBufferIndex, j ).mFrameBuffer == frameBuffer )
+          {
+            mImpl->partialUpdatePossible = false;
+          }
+        }
+      }
+
+      // Count the program and texture binds of this frame
+      mImpl->programController.ResetProgramBindCount();
+      mImpl->context.ResetTextureBindCount();
+      for( auto&& surfaceContext : mImpl->surfaceContextContainer )
+      {
+        surfaceContext->ResetTextureBindCount();
+      }
+
       for( uint32_t i = 0; i < count; ++i )
       {
         RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
@@ -551,6 +645,23 @@ void RenderManager::Render( Integration::RenderStatus& status, bool forceClear,
         DoRender( instruction );
       }
 
+#if defined(DEBUG_ENABLED)
+      uint32_t textureBindCount = mImpl->context.GetTextureBindCount();
+      for( auto&& surfaceContext : mImpl->surfaceContextContainer )
+      {
+        textureBindCount += surfaceContext->GetTextureBindCount();
+      }
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Render: program binds(%u) texture binds(%u)\n",
+                     mImpl->programController.GetProgramBindCount(), textureBindCount );
+#endif
+
+      // The updated textures have been redrawn in all surfaces using them
+      for( auto&& texture : mImpl->updatedTextures )
+      {
+        texture->ResetUpdated();
+      }
+      mImpl->updatedTextures.Clear();
+
       if ( mImpl->currentContext->IsSurfacelessContextSupported() )
       {
         mImpl->glContextHelperAbstraction.MakeSurfacelessContextCurrent();
@@ -673,45 +784,6 @@ void RenderManager::DoRender( RenderInstruction& instruction )
     mImpl->currentContext->BindFramebuffer( GL_FRAMEBUFFER, 0u );
   }
 
-  if ( surfaceFrameBuffer )
-  {
-    mImpl->currentContext->Viewport( surfaceRect.x,
-                              surfaceRect.y,
-                              surfaceRect.width,
-                              surfaceRect.height );
-
-    mImpl->currentContext->ClearColor( backgroundColor.r,
-                                backgroundColor.g,
-                                backgroundColor.b,
-                                backgroundColor.a );
-  }
-
-  // Clear the entire color, depth and stencil buffers for the default framebuffer, if required.
-  // It is important to clear all 3 buffers when they are being used, for performance on deferred renderers
-  // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
-  // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
-
-  mImpl->currentContext->SetScissorTest( false );
-
-  GLbitfield clearMask = GL_COLOR_BUFFER_BIT;
-
-  mImpl->currentContext->ColorMask( true );
-
-  if( depthBufferAvailable == Integration::DepthBufferAvailable::TRUE )
-  {
-    mImpl->currentContext->DepthMask( true );
-    clearMask |= GL_DEPTH_BUFFER_BIT;
-  }
-
-  if( stencilBufferAvailable == Integration::StencilBufferAvailable::TRUE)
-  {
-    mImpl->currentContext->ClearStencil( 0 );
-    mImpl->currentContext->StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
-    clearMask |= GL_STENCIL_BUFFER_BIT;
-  }
-
-  mImpl->currentContext->Clear( clearMask, Context::FORCE_CLEAR );
-
   if( !instruction.mIgnoreRenderToFbo && ( instruction.mFrameBuffer != 0 ) )
   {
     if ( instruction.mFrameBuffer->IsSurfaceBacked() ) // Surface rendering
@@ -764,6 +836,63 @@ void RenderManager::DoRender( RenderInstruction& instruction )
     }
   }
 
+  // Find the area of the surface which has to be redrawn
+  Rect<int32_t> damagedRect = surfaceRect;
+  bool partialUpdate = false;
+  if ( surfaceFrameBuffer && ( mImpl->partialUpdateAvailable == Integration::PartialUpdateAvailable::TRUE ) )
+  {
+    damagedRect = CalculateDamagedRect( instruction, *surfaceFrameBuffer, viewportRect, surfaceRect );
+    partialUpdate = ( damagedRect != surfaceRect );
+  }
+
+  if ( surfaceFrameBuffer )
+  {
+    mImpl->currentContext->Viewport( surfaceRect.x,
+                              surfaceRect.y,
+                              surfaceRect.width,
+                              surfaceRect.height );
+
+    mImpl->currentContext->ClearColor( backgroundColor.r,
+                                backgroundColor.g,
+                                backgroundColor.b,
+                                backgroundColor.a );
+  }
+
+  // Clear the entire color, depth and stencil buffers for the default framebuffer, if required.
+  // It is important to clear all 3 buffers when they are being used, for performance on deferred renderers
+  // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
+  // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
+
+  // Only the damaged area is cleared for a partial update
+  mImpl->currentContext->SetScissorTest( partialUpdate );
+  if( partialUpdate )
+  {
+    mImpl->currentContext->Scissor( damagedRect.x, damagedRect.y, damagedRect.width, damagedRect.height );
+  }
+
+  GLbitfield clearMask = GL_COLOR_BUFFER_BIT;
+
+  mImpl->currentContext->ColorMask( true );
+
+  if( depthBufferAvailable == Integration::DepthBufferAvailable::TRUE )
+  {
+    mImpl->currentContext->DepthMask( true );
+    clearMask |= GL_DEPTH_BUFFER_BIT;
+  }
+
+  if( stencilBufferAvailable == Integration::StencilBufferAvailable::TRUE)
+  {
+    mImpl->currentContext->ClearStencil( 0 );
+    mImpl->currentContext->StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
+    clearMask |= GL_STENCIL_BUFFER_BIT;
+  }
+
+  if( !partialUpdate || !damagedRect.IsEmpty() )
+  {
+    mImpl->currentContext->Clear( clearMask, Context::FORCE_CLEAR );
+  }
+  mImpl->currentContext->SetScissorTest( false );
+
   mImpl->currentContext->Viewport(viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height);
 
   if ( instruction.mIsClearColorSet )
@@ -773,9 +902,10 @@ void RenderManager::DoRender( RenderInstruction& instruction )
                                        clearColor.b,
                                        clearColor.a );
 
-    // Clear the viewport area only
+    // Clear the viewport area only, or the damaged part of it for a partial update
+    const Rect<int32_t> clearRect = partialUpdate ? IntersectRect( viewportRect, damagedRect ) : viewportRect;
     mImpl->currentContext->SetScissorTest( true );
-    mImpl->currentContext->Scissor( viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height );
+    mImpl->currentContext->Scissor( clearRect.x, clearRect.y, clearRect.width, clearRect.height );
     mImpl->currentContext->ColorMask( true );
     mImpl->currentContext->Clear( GL_COLOR_BUFFER_BIT , Context::CHECK_CACHED_VALUES );
     mImpl->currentContext->SetScissorTest( false );
@@ -784,13 +914,18 @@ void RenderManager::DoRender( RenderInstruction& instruction )
   // Clear the list of bound textures
   mImpl->boundTextures.Clear();
 
-  mImpl->renderAlgorithms.ProcessRenderInstruction(
-      instruction,
-      *mImpl->currentContext,
-      mImpl->renderBufferIndex,
-      depthBufferAvailable,
-      stencilBufferAvailable,
-      mImpl->boundTextures );
+  // Nothing needs to be redrawn if the damaged area is empty
+  if( !partialUpdate || !damagedRect.IsEmpty() )
+  {
+    mImpl->renderAlgorithms.ProcessRenderInstruction(
+        instruction,
+        *mImpl->currentContext,
+        mImpl->renderBufferIndex,
+        depthBufferAvailable,
+        stencilBufferAvailable,
+        mImpl->boundTextures,
+        partialUpdate ? damagedRect : Rect<int32_t>() );
+  }
 
   // Synchronise the FBO/Texture access when there are multiple contexts
   if ( mImpl->currentContext->IsSurfacelessContextSupported() )
@@ -866,6 +1001,7 @@ void RenderManager::DoRender( RenderInstruction& instruction )
 
   if ( surfaceFrameBuffer )
   {
+    surfaceFrameBuffer->SetDamagedRect( partialUpdate ? damagedRect : Rect<int32_t>() );
     surfaceFrameBuffer->PostRender();
   }
   else
@@ -874,6 +1010,170 @@ void RenderManager::DoRender( RenderInstruction& instruction )
   }
 }
 
+Rect<int32_t> RenderManager::CalculateDamagedRect( RenderInstruction& instruction,
+                                                   Render::SurfaceFrameBuffer& surfaceFrameBuffer,
+                                                   const Rect<int32_t>& viewportRect,
+                                                   const Rect<int32_t>& surfaceRect )
+{
+  const int32_t bufferAge = surfaceFrameBuffer.GetBufferAge();
+  if( !mImpl->partialUpdatePossible || ( bufferAge <= 0 ) )
+  {
+    // Nothing is recorded while the whole surface is redrawn, so the next partial update starts from a full redraw
+    surfaceFrameBuffer.ResetDamage();
+    return surfaceRect;
+  }
+
+  // Record the area of the surface covered by each render item in this frame
+  Render::SurfaceFrameBuffer::ItemRectContainer& itemRects = mImpl->itemRects;
+  itemRects.clear();
+  uint32_t drawOrder = 0u;
+
+  const Matrix* projectionMatrix = instruction.GetProjectionMatrix( mImpl->renderBufferIndex );
+  if( projectionMatrix )
+  {
+    const RenderListContainer::SizeType renderListCount = instruction.RenderListCount();
+    for( RenderListContainer::SizeType index = 0; index < renderListCount; ++index )
+    {
+      const RenderList* renderList = instruction.GetRenderList( index );
+      if( renderList && !renderList->IsEmpty() )
+      {
+        const std::size_t itemCount = renderList->Count();
+        for( uint32_t itemIndex = 0u; itemIndex < itemCount; ++itemIndex )
+        {
+          const RenderItem& item = renderList->GetItem( itemIndex );
+          if( DALI_LIKELY( item.mRenderer ) )
+          {
+            // The shader may draw anywhere in the viewport if it modifies the geometry
+            Rect<int32_t> rect = viewportRect;
+            if( !item.mRenderer->IsGeometryModifiedByShader() )
+            {
+              rect = item.CalculateProjectedViewportSpaceAABB( *projectionMatrix, viewportRect.width, viewportRect.height );
+              rect.x += viewportRect.x;
+              rect.y += viewportRect.y;
+            }
+
+            const bool updated = item.mUpdated || item.mRenderer->Updated();
+            itemRects.push_back( { item.mNode, item.mRenderer, rect, drawOrder++, item.mDepthIndex, updated } );
+          }
+        }
+      }
+    }
+  }
+
+  std::sort( itemRects.begin(), itemRects.end() );
+
+  // Compare with the items of the last frame; anything added, removed, moved or updated is damaged
+  static constexpr uint32_t NO_ORDER = std::numeric_limits< uint32_t >::max();
+  auto& itemOrders = mImpl->itemOrders;
+  itemOrders.assign( itemRects.size(), std::make_pair( NO_ORDER, 0u ) );
+
+  Rect<int32_t> damagedRect;
+  Render::SurfaceFrameBuffer::ItemRectContainer& lastItemRects = surfaceFrameBuffer.GetItemRects();
+  auto current = itemRects.cbegin();
+  auto last = lastItemRects.cbegin();
+  while( ( current != itemRects.cend() ) || ( last != lastItemRects.cend() ) )
+  {
+    if( ( last == lastItemRects.cend() ) || ( ( current != itemRects.cend() ) && ( *current < *last ) ) )
+    {
+      // Added in this frame
+      MergeRect( damagedRect, current->rect );
+      ++current;
+    }
+    else if( ( current == itemRects.cend() ) || ( *last < *current ) )
+    {
+      // Removed in this frame
+      MergeRect( damagedRect, last->rect );
+      ++last;
+    }
+    else
+    {
+      if( current->updated || ( current->rect != last->rect ) || ( current->depthIndex != last->depthIndex ) )
+      {
+        MergeRect( damagedRect, current->rect );
+        MergeRect( damagedRect, last->rect );
+      }
+      itemOrders[ current->drawOrder ] = std::make_pair( last->drawOrder, static_cast<uint32_t>( current - itemRects.cbegin() ) );
+      ++current;
+      ++last;
+    }
+  }
+
+  // The items kept from the last frame must be redrawn where the order they are drawn in has changed, e.g. when raised or lowered.
+  // Each pair of items which swapped includes an item outside the longest run of items still drawn in their last order,
+  // so only the items outside that run are damaged; added or removed items do not change the order of the others.
+  auto& runTails = mImpl->itemOrderRunTails;
+  auto& runPrevious = mImpl->itemOrderRunPrevious;
+  runTails.clear();
+  runPrevious.resize( itemOrders.size() );
+  for( uint32_t index = 0u; index < itemOrders.size(); ++index )
+  {
+    const uint32_t lastOrder = itemOrders[index].first;
+    if( lastOrder != NO_ORDER )
+    {
+      // Extend the longest run ending with a lower last order
+      auto tail = std::lower_bound( runTails.begin(), runTails.end(), lastOrder,
+                                    [&itemOrders]( uint32_t runIndex, uint32_t order ) { return itemOrders[runIndex].first < order; } );
+      runPrevious[index] = ( tail == runTails.begin() ) ? NO_ORDER : *( tail - 1 );
+      if( tail == runTails.end() )
+      {
+        runTails.push_back( index );
+      }
+      else
+      {
+        *tail = index;
+      }
+    }
+  }
+
+  if( !runTails.empty() )
+  {
+    for( uint32_t index = runTails.back(); index != NO_ORDER; index = runPrevious[index] )
+    {
+      itemOrders[index].first = NO_ORDER;
+    }
+    for( auto&& itemOrder : itemOrders )
+    {
+      if( itemOrder.first != NO_ORDER )
+      {
+        MergeRect( damagedRect, itemRects[ itemOrder.second ].rect );
+      }
+    }
+  }
+
+  // Keep the items of this frame for the next one; the old container is reused as scratch space
+  lastItemRects.swap( itemRects );
+
+  // The back buffer holds the contents from bufferAge frames ago, so the damage of the frames since then must be redrawn too
+  Render::SurfaceFrameBuffer::DamagedRectContainer& damagedRectHistory = surfaceFrameBuffer.GetDamagedRectHistory();
+  const bool fullRedrawRequired = surfaceFrameBuffer.IsFullRedrawRequired();
+
+  Rect<int32_t> totalDamagedRect = damagedRect;
+  if( fullRedrawRequired || ( static_cast<uint32_t>( bufferAge ) > damagedRectHistory.size() + 1u ) )
+  {
+    damagedRect = surfaceRect;
+    totalDamagedRect = surfaceRect;
+  }
+  else
+  {
+    for( int32_t i = 0; i < bufferAge - 1; ++i )
+    {
+      MergeRect( totalDamagedRect, damagedRectHistory[i] );
+    }
+    totalDamagedRect = IntersectRect( totalDamagedRect, surfaceRect );
+  }
+
+  damagedRectHistory.insert( damagedRectHistory.begin(), damagedRect );
+  if( damagedRectHistory.size() > Render::SurfaceFrameBuffer::MAX_DAMAGED_RECT_HISTORY )
+  {
+    damagedRectHistory.resize( Render::SurfaceFrameBuffer::MAX_DAMAGED_RECT_HISTORY );
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "CalculateDamagedRect: bufferAge(%d) damagedRect(%d, %d, %d, %d)\n",
+                 bufferAge, totalDamagedRect.x, totalDamagedRect.y, totalDamagedRect.width, totalDamagedRect.height );
+
+  return totalDamagedRect;
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -48,6 +48,7 @@ class ShaderSaver;
 namespace Render
 {
 class FrameBuffer;
+class SurfaceFrameBuffer;
 class Renderer;
 struct Sampler;
 class RenderTracker;
@@ -78,12 +79,14 @@ public:
    * @param[in]  glContextHelperAbstraction The GL context helper abstraction for accessing GL context.
    * @param[in]  depthBufferAvailable       Whether the depth buffer is available
    * @param[in]  stencilBufferAvailable     Whether the stencil buffer is available
+   * @param[in]  partialUpdateAvailable     Whether the surfaces can be partially updated
    */
   static RenderManager* New( Integration::GlAbstraction& glAbstraction,
                              Integration::GlSyncAbstraction& glSyncAbstraction,
                              Integration::GlContextHelperAbstraction& glContextHelperAbstraction,
                              Integration::DepthBufferAvailable depthBufferAvailable,
-                             Integration::StencilBufferAvailable stencilBufferAvailable );
+                             Integration::StencilBufferAvailable stencilBufferAvailable,
+                             Integration::PartialUpdateAvailable partialUpdateAvailable );
 
   /**
    * Non-virtual destructor; not intended as a base class
@@ -340,6 +343,21 @@ private:
    */
   void DoRender( RenderInstruction& instruction );
 
+  /**
+   * Helper to find the area of a surface which has to be redrawn for a RenderInstruction.
+   * The area covered by each render item is recorded, so anything added, removed, moved, updated or drawn in a different
+   * order since the last frame is redrawn, along with the areas changed in older frames which are still in the back buffer.
+   * @param[in] instruction A description of the rendering operation.
+   * @param[in] surfaceFrameBuffer The surface being rendered to.
+   * @param[in] viewportRect The viewport of the instruction, in surface coordinates.
+   * @param[in] surfaceRect The area of the whole surface.
+   * @return The damaged area in surface coordinates; the whole surface if a partial update is not possible in this frame.
+   */
+  Rect<int32_t> CalculateDamagedRect( RenderInstruction& instruction,
+                                      Render::SurfaceFrameBuffer& surfaceFrameBuffer,
+                                      const Rect<int32_t>& viewportRect,
+                                      const Rect<int32_t>& surfaceRect );
+
 private:
 
   /**
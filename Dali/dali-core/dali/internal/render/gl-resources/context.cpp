@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <type_traits>
 
@@ -88,6 +89,7 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mBoundArrayBufferId(0),
   mBoundElementArrayBufferId(0),
   mBoundTransformFeedbackBufferId(0),
+  mBoundUniformBufferId(0),
   mActiveTextureUnit( TEXTURE_UNIT_LAST ),
   mBlendColor(Color::TRANSPARENT),
   mBlendFuncSeparateSrcRGB(GL_ONE),
@@ -104,6 +106,9 @@ Context::Context( Integration::GlAbstraction& glAbstraction, OwnerContainer< Con
   mStencilOpDepthPass( GL_KEEP ),
   mDepthFunction( GL_LESS ),
   mMaxTextureSize(0),
+  mGlesVersion(20),
+  mUniformBufferOffsetAlignment(0),
+  mTextureBindCount(0),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
   mCullFaceMode( FaceCullingMode::NONE ),
   mViewPort( 0, 0, 0, 0 ),
@@ -227,6 +232,7 @@ void Context::InitializeGlState()
   mBoundArrayBufferId = 0;
   mBoundElementArrayBufferId = 0;
   mBoundTransformFeedbackBufferId = 0;
+  mBoundUniformBufferId = 0;
   mActiveTextureUnit = TEXTURE_UNIT_IMAGE;
 
   mUsingDefaultBlendColor = true; //Default blend color is (0,0,0,0)
@@ -245,6 +251,24 @@ void Context::InitializeGlState()
   // get maximum texture size
   mGlAbstraction.GetIntegerv(GL_MAX_TEXTURE_SIZE, &mMaxTextureSize);
 
+  // get the OpenGL ES version from the version string, e.g. "OpenGL ES 3.0 ...", as GL_MAJOR_VERSION is not available in OpenGL ES 2.0
+  mGlesVersion = 20;
+  const char* versionString = reinterpret_cast< const char* >( mGlAbstraction.GetString( GL_VERSION ) );
+  int majorVersion( 0 );
+  int minorVersion( 0 );
+  if( versionString && ( sscanf( versionString, "OpenGL ES %d.%d", &majorVersion, &minorVersion ) == 2 ) )
+  {
+    mGlesVersion = majorVersion * 10 + minorVersion;
+  }
+
+  mUniformBufferOffsetAlignment = 0u;
+  if( mGlesVersion >= 30 )
+  {
+    GLint alignment( 0 );
+    mGlAbstraction.GetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment );
+    mUniformBufferOffsetAlignment = static_cast<uint32_t>( alignment );
+  }
+
   // reset viewport, this will be set to something useful when rendering
   mViewPort.x = mViewPort.y = mViewPort.width = mViewPort.height = 0;
 
@@ -141,6 +141,7 @@ public:
     mBoundArrayBufferId = 0;
     mBoundElementArrayBufferId = 0;
     mBoundTransformFeedbackBufferId = 0;
+    mBoundUniformBufferId = 0;
   }
 
   void ResetTextureCache()
@@ -271,6 +272,33 @@ public:
     }
   }
 
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBuffer(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBuffer(GLuint buffer)
+  {
+    // Avoid unecessary calls to BindBuffer
+    if (mBoundUniformBufferId != buffer)
+    {
+      mBoundUniformBufferId = buffer;
+
+      LOG_GL("BindBuffer GL_UNIFORM_BUFFER %d\n", buffer);
+      CHECK_GL( mGlAbstraction, mGlAbstraction.BindBuffer(GL_UNIFORM_BUFFER, buffer) );
+    }
+  }
+
+  /**
+   * Wrapper for OpenGL ES 3.0 glBindBufferRange(GL_UNIFORM_BUFFER, ...)
+   */
+  void BindUniformBufferRange(GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+  {
+    // glBindBufferRange also binds the buffer to the generic binding point
+    mBoundUniformBufferId = buffer;
+
+    LOG_GL("BindBufferRange GL_UNIFORM_BUFFER %d %d %d %d\n", index, buffer, offset, size);
+    CHECK_GL( mGlAbstraction, mGlAbstraction.BindBufferRange(GL_UNIFORM_BUFFER, index, buffer, offset, size) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glBindFramebuffer()
    */
@@ -326,6 +354,7 @@ public:
     if (mBoundTextureId[ mActiveTextureUnit ] != texture)
     {
       mBoundTextureId[ mActiveTextureUnit ] = texture;
+      ++mTextureBindCount;
 
       LOG_GL("BindTexture target(%d) %d\n", target, texture);
       CHECK_GL( mGlAbstraction, mGlAbstraction.BindTexture(target, texture) );
@@ -876,6 +905,11 @@ public:
         result = mBoundTransformFeedbackBufferId;
         break;
       }
+      case GL_UNIFORM_BUFFER:
+      {
+        result = mBoundUniformBufferId;
+        break;
+      }
       default:
       {
         DALI_ASSERT_DEBUG(0 && "target buffer type not supported");
@@ -903,6 +937,15 @@ public:
     CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttribDivisor( index, divisor ) );
   }
 
+  /**
+   * Wrapper for OpenGL ES 2.0 glVertexAttrib4fv()
+   */
+  void VertexAttrib4fv( GLuint index, const GLfloat* values )
+  {
+    LOG_GL("VertexAttrib4fv(%d, %f, %f, %f, %f)\n", index, values[0], values[1], values[2], values[3] );
+    CHECK_GL( mGlAbstraction, mGlAbstraction.VertexAttrib4fv( index, values ) );
+  }
+
   /**
    * Wrapper for OpenGL ES 2.0 glVertexAttribPointer()
    */
@@ -1719,6 +1762,41 @@ public:
     return mMaxTextureSize;
   }
 
+  /**
+   * Get the OpenGL ES version of the context, e.g. 30 for OpenGL ES 3.0
+   * @return The version, cached when the GL state was initialised
+   */
+  int32_t CachedGlesVersion() const
+  {
+    return mGlesVersion;
+  }
+
+  /**
+   * Get the alignment required for the offset of a uniform buffer range.
+   * @return The alignment in bytes, or 0 if uniform buffers are not supported by the context
+   */
+  uint32_t CachedUniformBufferOffsetAlignment() const
+  {
+    return mUniformBufferOffsetAlignment;
+  }
+
+  /**
+   * Get the number of textures bound since the last call to ResetTextureBindCount()
+   * @return The number of texture binds
+   */
+  uint32_t GetTextureBindCount() const
+  {
+    return mTextureBindCount;
+  }
+
+  /**
+   * Reset the number of texture binds, e.g. at the beginning of a frame
+   */
+  void ResetTextureBindCount()
+  {
+    mTextureBindCount = 0u;
+  }
+
   /**
    * Get the current viewport.
    * @return Viewport rectangle.
@@ -1786,6 +1864,7 @@ private: // Data
   GLuint mBoundArrayBufferId;        ///< The ID passed to glBindBuffer(GL_ARRAY_BUFFER)
   GLuint mBoundElementArrayBufferId; ///< The ID passed to glBindBuffer(GL_ELEMENT_ARRAY_BUFFER)
   GLuint mBoundTransformFeedbackBufferId; ///< The ID passed to glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)
+  GLuint mBoundUniformBufferId; ///< The ID passed to glBindBuffer(GL_UNIFORM_BUFFER)
 
   // glBindTexture() state
   TextureUnit mActiveTextureUnit;
@@ -1815,6 +1894,9 @@ private: // Data
   GLenum mDepthFunction;  ///The depth function
 
   GLint mMaxTextureSize;      ///< return value from GetIntegerv(GL_MAX_TEXTURE_SIZE)
+  int32_t mGlesVersion;       ///< OpenGL ES version parsed from GetString(GL_VERSION), e.g. 30
+  uint32_t mUniformBufferOffsetAlignment; ///< return value from GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 0 before OpenGL ES 3.0
+  uint32_t mTextureBindCount; ///< Number of glBindTexture calls since the last reset
   Vector4 mClearColor;        ///< clear color
 
   // Face culling mode
@@ -113,6 +113,11 @@ void GpuBuffer::UpdateDataBuffer(Context& context, GLsizeiptr size, const GLvoid
     glTargetEnum = GL_TRANSFORM_FEEDBACK_BUFFER;
     context.BindTransformFeedbackBuffer( mBufferId );
   }
+  else if(UNIFORM_BUFFER == target)
+  {
+    glTargetEnum = GL_UNIFORM_BUFFER;
+    context.BindUniformBuffer( mBufferId );
+  }
 
   // if the buffer has already been created, just update the data providing it fits
   if (mBufferCreated )
@@ -150,6 +155,10 @@ void GpuBuffer::UpdateDataBuffer(Context& context, GLsizeiptr size, const GLvoid
   {
     context.BindTransformFeedbackBuffer( 0 );
   }
+  else if(UNIFORM_BUFFER == target)
+  {
+    context.BindUniformBuffer( 0 );
+  }
 }
 
 void GpuBuffer::Bind(Context& context, Target target) const
@@ -168,6 +177,17 @@ void GpuBuffer::Bind(Context& context, Target target) const
   {
     context.BindTransformFeedbackBuffer(mBufferId);
   }
+  else if (target == UNIFORM_BUFFER)
+  {
+    context.BindUniformBuffer(mBufferId);
+  }
+}
+
+void GpuBuffer::BindUniformRange(Context& context, GLuint index, GLintptr offset, GLsizeiptr size) const
+{
+  DALI_ASSERT_DEBUG(offset + size <= mCapacity);
+
+  context.BindUniformBufferRange(index, mBufferId, offset, size);
 }
 
 bool GpuBuffer::BufferIsValid() const
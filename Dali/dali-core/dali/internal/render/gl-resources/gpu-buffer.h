@@ -48,7 +48,8 @@ public:
   {
     ARRAY_BUFFER,             ///< GL_ARRAY_BUFFER
     ELEMENT_ARRAY_BUFFER,     ///< GL_ELEMENT_ARRAY_BUFFER
-    TRANSFORM_FEEDBACK_BUFFER ///< GL_TRANSFORM_FEEDBACK_BUFFER
+    TRANSFORM_FEEDBACK_BUFFER, ///< GL_TRANSFORM_FEEDBACK_BUFFER
+    UNIFORM_BUFFER            ///< GL_UNIFORM_BUFFER
   };
 
   /**
@@ -93,6 +94,15 @@ public:
    */
   void Bind(Context& context, Target target) const;
 
+  /**
+   * Bind a range of the buffer object to an indexed uniform buffer binding point
+   * @param context The context to bind the the buffer
+   * @param index The index of the binding point
+   * @param offset The offset of the range in bytes, which must be a multiple of the uniform buffer offset alignment
+   * @param size The size of the range in bytes
+   */
+  void BindUniformRange(Context& context, GLuint index, GLintptr offset, GLsizeiptr size) const;
+
   /**
    * @return true if the GPU buffer is valid, i.e. its created and not empty
    */
@@ -37,7 +37,8 @@ Geometry::Geometry()
   mGeometryType( Dali::Geometry::TRIANGLES ),
   mIndicesChanged(false),
   mHasBeenUpdated(false),
-  mAttributesChanged(true)
+  mAttributesChanged(true),
+  mUpdated(true)
 {
 }
 
@@ -107,6 +108,7 @@ void Geometry::OnRenderFinished()
 {
   mHasBeenUpdated = false;
   mAttributesChanged = false;
+  mUpdated = false;
 }
 
 void Geometry::Upload( Context& context )
@@ -116,6 +118,8 @@ void Geometry::Upload( Context& context )
     // Update buffers
     if( mIndicesChanged )
     {
+      mUpdated = true;
+
       if( mIndices.Empty() )
       {
         mIndexBuffer = NULL;
@@ -136,6 +140,7 @@ void Geometry::Upload( Context& context )
 
     for( auto&& buffer : mVertexBuffers )
     {
+      mUpdated = mUpdated || buffer->IsDataChanged();
       if( !buffer->Update( context ) )
       {
         //Vertex buffer is not ready ( Size, data or format has not been specified yet )
@@ -152,7 +157,8 @@ void Geometry::Draw(
     BufferIndex bufferIndex,
     Vector<GLint>& attributeLocation,
     uint32_t elementBufferOffset,
-    uint32_t elementBufferCount )
+    uint32_t elementBufferCount,
+    uint32_t instanceCount )
 {
   //Bind buffers to attribute locations
   uint32_t base = 0u;
@@ -228,7 +234,14 @@ void Geometry::Draw(
     //Indexed draw call
     mIndexBuffer->Bind( context, GpuBuffer::ELEMENT_ARRAY_BUFFER );
     // numIndices truncated, no value loss happening in practice
-    context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    if( instanceCount > 1u )
+    {
+      context.DrawElementsInstanced( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ), static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawElements( geometryGLType, static_cast<GLsizei>( numIndices ), GL_UNSIGNED_SHORT, reinterpret_cast<void*>( firstIndexOffset ) );
+    }
   }
   else
   {
@@ -240,7 +253,14 @@ void Geometry::Draw(
       numVertices = static_cast<GLsizei>( mVertexBuffers[0]->GetElementCount() );
     }
 
-    context.DrawArrays( geometryGLType, 0, numVertices );
+    if( instanceCount > 1u )
+    {
+      context.DrawArraysInstanced( geometryGLType, 0, numVertices, static_cast<GLsizei>( instanceCount ) );
+    }
+    else
+    {
+      context.DrawArrays( geometryGLType, 0, numVertices );
+    }
   }
 
   //Disable attributes
@@ -106,6 +106,15 @@ public:
     return mAttributesChanged;
   }
 
+  /**
+   * Check if the contents of the geometry have changed in the current rendering pass
+   * @return True if the indices or any vertex buffer were uploaded, or vertex buffers were added or removed, false otherwise
+   */
+  bool Updated() const
+  {
+    return mUpdated || mAttributesChanged;
+  }
+
   /**
    * Sets the geometry type
    * @param[in] type The new geometry type
@@ -128,12 +137,14 @@ public:
    * @param[in] attributeLocation The location for the attributes in the shader
    * @param[in] elementBufferOffset The index of first element to draw if index buffer bound
    * @param[in] elementBufferCount Number of elements to draw if index buffer bound, uses whole buffer when 0
+   * @param[in] instanceCount Number of instances to draw; an instanced draw call is used if greater than 1
    */
   void Draw(Context& context,
             BufferIndex bufferIndex,
             Vector<GLint>& attributeLocation,
             uint32_t elementBufferOffset,
-            uint32_t elementBufferCount );
+            uint32_t elementBufferCount,
+            uint32_t instanceCount );
 
 private:
 
@@ -148,6 +159,7 @@ private:
   bool mIndicesChanged : 1;
   bool mHasBeenUpdated : 1;
   bool mAttributesChanged : 1;
+  bool mUpdated : 1;
 };
 
 } // namespace Render
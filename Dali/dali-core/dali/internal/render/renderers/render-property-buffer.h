@@ -159,6 +159,15 @@ public:
     return mSize;
   }
 
+  /**
+   * Check if the data of the buffer has changed and not been uploaded yet
+   * @return True if new data or a new format has been set since the last upload
+   */
+  inline bool IsDataChanged() const
+  {
+    return mDataChanged;
+  }
+
   /**
    * Retrieve reference to the data storage vector
    * @return Reference to the data storage
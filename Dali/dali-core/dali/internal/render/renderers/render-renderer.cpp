@@ -18,13 +18,20 @@
 // CLASS HEADER
 #include <dali/internal/render/renderers/render-renderer.h>
 
+// EXTERNAL INCLUDES
+#include <cstring> // memcpy
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/image-sampler.h>
+#include <dali/internal/render/common/render-item.h>
+#include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/gl-resources/context.h>
+#include <dali/internal/render/gl-resources/gpu-buffer.h>
 #include <dali/internal/render/renderers/render-sampler.h>
 #include <dali/internal/render/shaders/scene-graph-shader.h>
 #include <dali/internal/render/shaders/program.h>
 #include <dali/internal/render/data-providers/node-data-provider.h>
+#include <dali/internal/update/nodes/node.h>
 
 namespace Dali
 {
@@ -37,6 +44,10 @@ namespace
 
 static Matrix gModelViewProjectionMatrix( false ); ///< a shared matrix to calculate the MVP matrix, dont want to store it in object to reduce storage overhead
 static Matrix3 gNormalMatrix; ///< a shared matrix to calculate normal matrix, dont want to store it in object to reduce storage overhead
+static Matrix gInstanceModelViewMatrix( false ); ///< a shared matrix to calculate the sized model-view matrix of an instance
+
+const uint32_t INSTANCE_MATRIX_FLOATS = 16u; ///< Number of floats in the per-instance model-view-projection matrix
+const uint32_t INSTANCE_FLOATS = INSTANCE_MATRIX_FLOATS + 4u; ///< Number of floats per instance; the matrix followed by the color
 
 /**
  * Helper to set view and projection matrices once per program
@@ -512,6 +523,87 @@ void Renderer::Upload( Context& context )
   mGeometry->Upload( context );
 }
 
+bool Renderer::Updated() const
+{
+  if( mGeometry->Updated() )
+  {
+    return true;
+  }
+
+  const std::vector<Render::Texture*>& textures( mRenderDataProvider->GetTextures() );
+  for( auto&& texture : textures )
+  {
+    if( texture && texture->IsUpdated() )
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool Renderer::IsGeometryModifiedByShader() const
+{
+  return mRenderDataProvider->GetShader().HintEnabled( Dali::Shader::Hint::MODIFIES_GEOMETRY );
+}
+
+bool Renderer::PrepareDraw( Context& context,
+                            BufferIndex bufferIndex,
+                            Program& program,
+                            const SceneGraph::NodeDataProvider& node,
+                            const Matrix& modelMatrix,
+                            const Matrix& modelViewMatrix,
+                            const Matrix& viewMatrix,
+                            const Matrix& projectionMatrix,
+                            const Vector3& size,
+                            bool blend,
+                            Vector<GLuint>& boundTextures )
+{
+  //Set cull face  mode
+  context.CullFace( mFaceCullingMode );
+
+  //Set blending mode
+  SetBlending( context, blend );
+
+  // Take the program into use so we can send uniforms to it
+  program.Use();
+
+  if( DALI_UNLIKELY( !BindTextures( context, program, boundTextures ) ) )
+  {
+    // Only set up and draw if we have textures and they are all valid
+    return false;
+  }
+
+  // set projection and view matrix if program has not yet received them yet this frame
+  SetMatrices( program, modelMatrix, viewMatrix, projectionMatrix, modelViewMatrix );
+
+  // set color uniform
+  GLint loc = program.GetUniformLocation( Program::UNIFORM_COLOR );
+  if( Program::UNIFORM_UNKNOWN != loc )
+  {
+    const Vector4& color = node.GetRenderColor( bufferIndex );
+    if( mPremultipledAlphaEnabled )
+    {
+      float alpha = color.a * mRenderDataProvider->GetOpacity( bufferIndex );
+      program.SetUniform4f( loc, color.r * alpha, color.g * alpha, color.b * alpha, alpha );
+    }
+    else
+    {
+      program.SetUniform4f( loc, color.r, color.g, color.b, color.a * mRenderDataProvider->GetOpacity( bufferIndex ) );
+    }
+  }
+
+  SetUniforms( bufferIndex, node, size, program );
+
+  if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
+  {
+    mGeometry->GetAttributeLocationFromProgram( mAttributesLocation, program, bufferIndex );
+    mUpdateAttributesLocation = false;
+  }
+
+  return true;
+}
+
 void Renderer::Render( Context& context,
                        BufferIndex bufferIndex,
                        const SceneGraph::NodeDataProvider& node,
@@ -531,52 +623,244 @@ void Renderer::Render( Context& context,
     return;
   }
 
-  //Set cull face  mode
-  context.CullFace( mFaceCullingMode );
+  if( DALI_LIKELY( PrepareDraw( context, bufferIndex, *program, node, modelMatrix, modelViewMatrix, viewMatrix, projectionMatrix, size, blend, boundTextures ) ) )
+  {
+    mGeometry->Draw( context,
+                     bufferIndex,
+                     mAttributesLocation,
+                     mIndexedDrawFirstElement,
+                     mIndexedDrawElementsCount,
+                     1u );
+  }
+}
 
-  //Set blending mode
-  SetBlending( context, blend );
+bool Renderer::IsInstancingSupported() const
+{
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  return program && program->IsInstancingSupported();
+}
 
-  // Take the program into use so we can send uniforms to it
-  program->Use();
+bool Renderer::CanBeInstancedWith( BufferIndex bufferIndex, const Renderer& other ) const
+{
+  if( this == &other )
+  {
+    return true;
+  }
 
-  if( DALI_LIKELY( BindTextures( context, *program, boundTextures ) ) )
+  // The stencil parameters are only used when the render mode is not AUTO
+  if( mGeometry != other.mGeometry ||
+      &mRenderDataProvider->GetShader() != &other.mRenderDataProvider->GetShader() ||
+      mStencilParameters.renderMode != RenderMode::AUTO ||
+      other.mStencilParameters.renderMode != RenderMode::AUTO ||
+      mFaceCullingMode != other.mFaceCullingMode ||
+      mDepthWriteMode != other.mDepthWriteMode ||
+      mDepthTestMode != other.mDepthTestMode ||
+      mDepthFunction != other.mDepthFunction ||
+      mIndexedDrawFirstElement != other.mIndexedDrawFirstElement ||
+      mIndexedDrawElementsCount != other.mIndexedDrawElementsCount ||
+      mPremultipledAlphaEnabled != other.mPremultipledAlphaEnabled ||
+      mBlendingOptions.GetBitmask() != other.mBlendingOptions.GetBitmask() )
   {
-    // Only set up and draw if we have textures and they are all valid
+    return false;
+  }
 
-    // set projection and view matrix if program has not yet received them yet this frame
-    SetMatrices( *program, modelMatrix, viewMatrix, projectionMatrix, modelViewMatrix );
+  const Vector4* blendColor = mBlendingOptions.GetBlendColor();
+  const Vector4* otherBlendColor = other.mBlendingOptions.GetBlendColor();
+  if( ( blendColor != otherBlendColor ) &&
+      ( !blendColor || !otherBlendColor || *blendColor != *otherBlendColor ) )
+  {
+    return false;
+  }
 
-    // set color uniform
-    GLint loc = program->GetUniformLocation( Program::UNIFORM_COLOR );
-    if( Program::UNIFORM_UNKNOWN != loc )
+  if( mRenderDataProvider->GetTextures() != other.mRenderDataProvider->GetTextures() ||
+      mRenderDataProvider->GetSamplers() != other.mRenderDataProvider->GetSamplers() )
+  {
+    return false;
+  }
+
+  // Every uniform must come from the same property, as the uniforms are only set once for the whole run
+  const SceneGraph::CollectedUniformMap& uniformMap = mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex );
+  const SceneGraph::CollectedUniformMap& otherUniformMap = other.mRenderDataProvider->GetUniformMap().GetUniformMap( bufferIndex );
+  if( uniformMap.Count() != otherUniformMap.Count() )
+  {
+    return false;
+  }
+  for( uint32_t i = 0u; i < static_cast<uint32_t>( uniformMap.Count() ); ++i )
+  {
+    if( uniformMap[i]->propertyPtr != otherUniformMap[i]->propertyPtr ||
+        uniformMap[i]->uniformNameHash != otherUniformMap[i]->uniformNameHash )
     {
-      const Vector4& color = node.GetRenderColor( bufferIndex );
-      if( mPremultipledAlphaEnabled )
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Renderer::RenderInstances( Context& context,
+                                BufferIndex bufferIndex,
+                                const SceneGraph::RenderList& renderList,
+                                uint32_t firstItem,
+                                uint32_t instanceCount,
+                                const Matrix& viewMatrix,
+                                const Matrix& projectionMatrix,
+                                bool blend,
+                                Vector<GLuint>& boundTextures,
+                                GpuBuffer& instanceBuffer,
+                                Vector<float>& instanceData )
+{
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  if( !program )
+  {
+    DALI_LOG_ERROR( "Failed to get program for shader at address %p.\n", reinterpret_cast< void* >( &mRenderDataProvider->GetShader() ) );
+    return;
+  }
+
+  const SceneGraph::RenderItem& firstRenderItem = renderList.GetItem( firstItem );
+  if( DALI_LIKELY( PrepareDraw( context, bufferIndex, *program, *firstRenderItem.mNode, firstRenderItem.mModelMatrix, firstRenderItem.mModelViewMatrix,
+                                viewMatrix, projectionMatrix, firstRenderItem.mSize, blend, boundTextures ) ) )
+  {
+    // Build the per-instance data
+    instanceData.Resize( instanceCount * INSTANCE_FLOATS );
+    float* data = instanceData.Begin();
+    for( uint32_t i = 0u; i < instanceCount; ++i, data += INSTANCE_FLOATS )
+    {
+      const SceneGraph::RenderItem& item = renderList.GetItem( firstItem + i );
+
+      // Apply the size of the item to the model-view matrix, as done by the shaders with uSize
+      gInstanceModelViewMatrix = item.mModelViewMatrix;
+      float* modelView = gInstanceModelViewMatrix.AsFloat();
+      for( uint32_t column = 0u; column < 3u; ++column )
+      {
+        const float scale = item.mSize[ column ];
+        for( uint32_t row = 0u; row < 4u; ++row )
+        {
+          modelView[ column * 4u + row ] *= scale;
+        }
+      }
+      Matrix::Multiply( gModelViewProjectionMatrix, gInstanceModelViewMatrix, projectionMatrix );
+      memcpy( data, gModelViewProjectionMatrix.AsFloat(), INSTANCE_MATRIX_FLOATS * sizeof( float ) );
+
+      item.mRenderer->GetColor( bufferIndex, *item.mNode, data + INSTANCE_MATRIX_FLOATS );
+    }
+
+    // A mat4 attribute uses four consecutive locations.
+    const GLint matrixLocation = program->GetAttribLocation( Program::ATTRIB_INSTANCE_MVP_MATRIX );
+    const GLint colorLocation = program->GetAttribLocation( Program::ATTRIB_INSTANCE_COLOR );
+
+    if( instanceCount == 1u )
+    {
+      // A single item does not need the instance buffer; the attribute arrays are disabled, so the constant values are read.
+      const float* itemData = instanceData.Begin();
+      for( GLuint column = 0u; column < 4u; ++column )
       {
-        float alpha = color.a * mRenderDataProvider->GetOpacity( bufferIndex );
-        program->SetUniform4f( loc, color.r * alpha, color.g * alpha, color.b * alpha, alpha );
+        const GLuint location = static_cast<GLuint>( matrixLocation ) + column;
+        context.DisableVertexAttributeArray( location );
+        context.VertexAttrib4fv( location, itemData + column * 4u );
       }
-      else
+      if( Program::ATTRIB_UNKNOWN != colorLocation )
       {
-        program->SetUniform4f( loc, color.r, color.g, color.b, color.a * mRenderDataProvider->GetOpacity( bufferIndex ) );
+        context.DisableVertexAttributeArray( static_cast<GLuint>( colorLocation ) );
+        context.VertexAttrib4fv( static_cast<GLuint>( colorLocation ), itemData + INSTANCE_MATRIX_FLOATS );
       }
+
+      mGeometry->Draw( context,
+                       bufferIndex,
+                       mAttributesLocation,
+                       mIndexedDrawFirstElement,
+                       mIndexedDrawElementsCount,
+                       1u );
+      return;
     }
 
-    SetUniforms( bufferIndex, node, size, *program );
+    instanceBuffer.UpdateDataBuffer( context,
+                                     static_cast<GLsizeiptr>( instanceData.Count() * sizeof( float ) ),
+                                     instanceData.Begin(),
+                                     GpuBuffer::STREAM_DRAW,
+                                     GpuBuffer::ARRAY_BUFFER );
 
-    if( mUpdateAttributesLocation || mGeometry->AttributesChanged() )
+    // The upload unbinds the buffer, so bind it again before pointing the instance attributes at it.
+    instanceBuffer.Bind( context, GpuBuffer::ARRAY_BUFFER );
+    const GLsizei stride = static_cast<GLsizei>( INSTANCE_FLOATS * sizeof( float ) );
+    for( GLuint column = 0u; column < 4u; ++column )
+    {
+      const GLuint location = static_cast<GLuint>( matrixLocation ) + column;
+      context.EnableVertexAttributeArray( location );
+      context.VertexAttribPointer( location, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void* >( column * 4u * sizeof( float ) ) );
+      context.VertexAttribDivisor( location, 1u );
+    }
+    if( Program::ATTRIB_UNKNOWN != colorLocation )
     {
-      mGeometry->GetAttributeLocationFromProgram( mAttributesLocation, *program, bufferIndex );
-      mUpdateAttributesLocation = false;
+      context.EnableVertexAttributeArray( static_cast<GLuint>( colorLocation ) );
+      context.VertexAttribPointer( static_cast<GLuint>( colorLocation ), 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast< const void* >( INSTANCE_MATRIX_FLOATS * sizeof( float ) ) );
+      context.VertexAttribDivisor( static_cast<GLuint>( colorLocation ), 1u );
     }
 
     mGeometry->Draw( context,
                      bufferIndex,
                      mAttributesLocation,
                      mIndexedDrawFirstElement,
-                     mIndexedDrawElementsCount );
+                     mIndexedDrawElementsCount,
+                     instanceCount );
+
+    // Restore the default state, so the attribute locations can be used by the next (non-instanced) draw
+    for( GLuint column = 0u; column < 4u; ++column )
+    {
+      const GLuint location = static_cast<GLuint>( matrixLocation ) + column;
+      context.VertexAttribDivisor( location, 0u );
+      context.DisableVertexAttributeArray( location );
+    }
+    if( Program::ATTRIB_UNKNOWN != colorLocation )
+    {
+      context.VertexAttribDivisor( static_cast<GLuint>( colorLocation ), 0u );
+      context.DisableVertexAttributeArray( static_cast<GLuint>( colorLocation ) );
+    }
+  }
+}
+
+bool Renderer::IsUniformBlockSupported() const
+{
+  Program* program = mRenderDataProvider->GetShader().GetProgram();
+  return program && program->IsUniformBlockSupported();
+}
+
+void Renderer::WriteUniformBlock( BufferIndex bufferIndex,
+                                  const SceneGraph::NodeDataProvider& node,
+                                  const Matrix& modelMatrix,
+                                  const Matrix& modelViewMatrix,
+                                  const Matrix& projectionMatrix,
+                                  const Vector3& size,
+                                  float* block )
+{
+  // std140 layout: mat4 uModelMatrix, mat4 uModelView, mat4 uMvpMatrix, vec4 uColor, vec3 uSize
+  memcpy( block, modelMatrix.AsFloat(), 16u * sizeof( float ) );
+  memcpy( block + 16u, modelViewMatrix.AsFloat(), 16u * sizeof( float ) );
+  Matrix::Multiply( gModelViewProjectionMatrix, modelViewMatrix, projectionMatrix );
+  memcpy( block + 32u, gModelViewProjectionMatrix.AsFloat(), 16u * sizeof( float ) );
+  GetColor( bufferIndex, node, block + 48u );
+  block[52u] = size.x;
+  block[53u] = size.y;
+  block[54u] = size.z;
+  block[55u] = 0.0f;
+}
+
+void Renderer::GetColor( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, float* color )
+{
+  const Vector4& nodeColor = node.GetRenderColor( bufferIndex );
+  const float alpha = nodeColor.a * mRenderDataProvider->GetOpacity( bufferIndex );
+  if( mPremultipledAlphaEnabled )
+  {
+    color[0] = nodeColor.r * alpha;
+    color[1] = nodeColor.g * alpha;
+    color[2] = nodeColor.b * alpha;
+  }
+  else
+  {
+    color[0] = nodeColor.r;
+    color[1] = nodeColor.g;
+    color[2] = nodeColor.b;
   }
+  color[3] = alpha;
 }
 
 void Renderer::SetSortAttributes( BufferIndex bufferIndex,
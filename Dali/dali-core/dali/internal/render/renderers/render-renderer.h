@@ -40,12 +40,14 @@ namespace Internal
 class Context;
 class Texture;
 class Program;
+class GpuBuffer;
 
 namespace SceneGraph
 {
 class SceneController;
 class Shader;
 class NodeDataProvider;
+class RenderList;
 }
 
 namespace Render
@@ -340,6 +342,19 @@ public:
    */
   void Upload( Context& context );
 
+  /**
+   * Query whether the contents of the geometry or of any texture used by this renderer have changed in this frame.
+   * This is used to find the area of the surface which must be redrawn in a partial update.
+   * @return True if the geometry or any texture has been updated
+   */
+  bool Updated() const;
+
+  /**
+   * Query whether the shader may move vertices outside the area given by the transform of the render item.
+   * @return True if the shader has the MODIFIES_GEOMETRY hint
+   */
+  bool IsGeometryModifiedByShader() const;
+
   /**
    * Called to render during RenderManager::Render().
    * @param[in] context The context used for rendering
@@ -363,6 +378,78 @@ public:
                bool blend,
                Vector<GLuint>& boundTextures );
 
+  /**
+   * Query whether the shader program declares the per-instance attributes used by RenderInstances().
+   * @return True if the items of this renderer can be drawn with an instanced draw call
+   */
+  bool IsInstancingSupported() const;
+
+  /**
+   * Query whether the items of this renderer and of another renderer can be drawn with a single instanced draw call.
+   * This requires the same geometry, shader, textures, samplers, uniform map and render state.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] other The renderer of the following render item
+   * @return True if both renderers can be drawn by the same instanced draw call
+   */
+  bool CanBeInstancedWith( BufferIndex bufferIndex, const Renderer& other ) const;
+
+  /**
+   * Render a run of compatible render items with one instanced draw call.
+   * The model-view-projection matrix (with the size of the item applied) and the color of each item are
+   * written to the instance buffer and passed to the aInstanceMvpMatrix and aInstanceColor attributes.
+   * All other uniforms are taken from the first item of the run.
+   * A single item is drawn without instancing, with the attributes set as constant values; this also works on OpenGL ES 2.0.
+   * @pre IsInstancingSupported() returns true and the renderers of all the items in the run have been checked with CanBeInstancedWith().
+   * @pre instanceCount is 1 if the context does not support OpenGL ES 3.0
+   * @param[in] context The context used for rendering
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render list containing the items
+   * @param[in] firstItem The index of the first item of the run, which must use this renderer
+   * @param[in] instanceCount The number of items in the run
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] blend If true, blending is enabled
+   * @param[in] boundTextures The textures bound for rendering
+   * @param[in] instanceBuffer The buffer used to upload the per-instance data
+   * @param[in] instanceData Scratch memory used to build the per-instance data
+   */
+  void RenderInstances( Context& context,
+                        BufferIndex bufferIndex,
+                        const SceneGraph::RenderList& renderList,
+                        uint32_t firstItem,
+                        uint32_t instanceCount,
+                        const Matrix& viewMatrix,
+                        const Matrix& projectionMatrix,
+                        bool blend,
+                        Vector<GLuint>& boundTextures,
+                        GpuBuffer& instanceBuffer,
+                        Vector<float>& instanceData );
+
+  /**
+   * Query whether the shader program reads the standard uniforms from uniform blocks.
+   * @pre The context supports OpenGL ES 3.0
+   * @return True if the per-item uniforms must be written with WriteUniformBlock()
+   */
+  bool IsUniformBlockSupported() const;
+
+  /**
+   * Write the standard per-item uniforms to a DaliItemBlock uniform block, see Program::UniformBlockType.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @param[in] modelMatrix The model matrix.
+   * @param[in] modelViewMatrix The model-view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] size Size of the render item
+   * @param[out] block The memory of the uniform block, Program::ITEM_UNIFORM_BLOCK_SIZE bytes
+   */
+  void WriteUniformBlock( BufferIndex bufferIndex,
+                          const SceneGraph::NodeDataProvider& node,
+                          const Matrix& modelMatrix,
+                          const Matrix& modelViewMatrix,
+                          const Matrix& projectionMatrix,
+                          const Vector3& size,
+                          float* block );
+
   /**
    * Write the renderer's sort attributes to the passed in reference
    *
@@ -414,6 +501,41 @@ private:
    */
   bool BindTextures( Context& context, Program& program, Vector<GLuint>& boundTextures );
 
+  /**
+   * Calculate the color of a render item, the color of the node multiplied by the opacity of the renderer.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] node The node using this renderer
+   * @param[out] color The four components of the color, premultiplied if required by the renderer
+   */
+  void GetColor( BufferIndex bufferIndex, const SceneGraph::NodeDataProvider& node, float* color );
+
+  /**
+   * Set up the GL state, the program and its uniforms for drawing the geometry.
+   * @param[in] context The context used for rendering
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] program The shader program
+   * @param[in] node The node using this renderer
+   * @param[in] modelMatrix The model matrix.
+   * @param[in] modelViewMatrix The model-view matrix.
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] size Size of the render item
+   * @param[in] blend If true, blending is enabled
+   * @param[in] boundTextures The textures bound for rendering
+   * @return False if the textures could not be bound, in which case nothing should be drawn.
+   */
+  bool PrepareDraw( Context& context,
+                    BufferIndex bufferIndex,
+                    Program& program,
+                    const SceneGraph::NodeDataProvider& node,
+                    const Matrix& modelMatrix,
+                    const Matrix& modelViewMatrix,
+                    const Matrix& viewMatrix,
+                    const Matrix& projectionMatrix,
+                    const Vector3& size,
+                    bool blend,
+                    Vector<GLuint>& boundTextures );
+
 private:
 
   OwnerPointer< SceneGraph::RenderDataProvider > mRenderDataProvider;
@@ -34,7 +34,11 @@ SurfaceFrameBuffer::SurfaceFrameBuffer( Integration::RenderSurface* surface )
   mWidth( mSurface->GetPositionSize().width ),
   mHeight( mSurface->GetPositionSize().height ),
   mBackgroundColor( 0.f, 0.f, 0.f, 1.f ),
+  mDamagedRect(),
+  mItemRects(),
+  mDamagedRectHistory(),
   mSizeChanged( false ),
+  mFullRedrawRequired( true ),
   mIsSurfaceInvalid( false )
 {
 }
@@ -100,10 +104,12 @@ void SurfaceFrameBuffer::PostRender()
 {
   if ( IsSurfaceValid() )
   {
+    mSurface->SetDamagedRect( mDamagedRect );
     mSurface->PostRender( false, false, mSizeChanged );
   }
 
   mSizeChanged = false;
+  mDamagedRect = Rect<int32_t>();
 }
 
 Context* SurfaceFrameBuffer::GetContext()
@@ -124,16 +130,52 @@ Vector4 SurfaceFrameBuffer::GetBackgroundColor()
   return mBackgroundColor;
 }
 
+int32_t SurfaceFrameBuffer::GetBufferAge()
+{
+  return IsSurfaceValid() ? mSurface->GetBufferAge() : 0;
+}
+
+void SurfaceFrameBuffer::SetDamagedRect( const Rect<int32_t>& damagedRect )
+{
+  mDamagedRect = damagedRect;
+}
+
+bool SurfaceFrameBuffer::IsFullRedrawRequired()
+{
+  const bool fullRedrawRequired = mFullRedrawRequired;
+  mFullRedrawRequired = false;
+  return fullRedrawRequired;
+}
+
+SurfaceFrameBuffer::ItemRectContainer& SurfaceFrameBuffer::GetItemRects()
+{
+  return mItemRects;
+}
+
+SurfaceFrameBuffer::DamagedRectContainer& SurfaceFrameBuffer::GetDamagedRectHistory()
+{
+  return mDamagedRectHistory;
+}
+
+void SurfaceFrameBuffer::ResetDamage()
+{
+  mItemRects.clear();
+  mDamagedRectHistory.clear();
+  mFullRedrawRequired = true;
+}
+
 void SurfaceFrameBuffer::SetSize( uint32_t width, uint32_t height )
 {
   mWidth = width;
   mHeight = height;
   mSizeChanged = true;
+  mFullRedrawRequired = true;
 }
 
 void SurfaceFrameBuffer::SetBackgroundColor( const Vector4& color )
 {
   mBackgroundColor = color;
+  mFullRedrawRequired = true;
 }
 
 bool SurfaceFrameBuffer::IsSurfaceValid() const
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <atomic>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/internal/update/manager/update-manager.h>
@@ -40,6 +41,29 @@ class SurfaceFrameBuffer : public FrameBuffer
 {
 public:
 
+  /**
+   * The area of the surface covered by a render item, recorded to find what changed between frames for partial update
+   */
+  struct ItemRect
+  {
+    const void*   node;       ///< The node of the render item, only used as a key
+    const void*   renderer;   ///< The renderer of the render item, only used as a key
+    Rect<int32_t> rect;       ///< The area of the surface covered by the render item
+    uint32_t      drawOrder;  ///< The index of the render item in the order the items are drawn
+    int32_t       depthIndex; ///< The depth index of the render item
+    bool          updated;    ///< Whether the render item has changed in the frame it was recorded
+
+    bool operator<( const ItemRect& rhs ) const
+    {
+      return ( node < rhs.node ) || ( ( node == rhs.node ) && ( renderer < rhs.renderer ) );
+    }
+  };
+
+  using ItemRectContainer = std::vector< ItemRect >;
+  using DamagedRectContainer = std::vector< Rect<int32_t> >;
+
+  static constexpr uint32_t MAX_DAMAGED_RECT_HISTORY = 3u; ///< The maximum buffer age supported for partial update
+
   /**
    * Constructor
    * @param[in] surface The render surface
@@ -135,6 +159,43 @@ public:
    */
   Vector4 GetBackgroundColor();
 
+  /**
+   * @brief Gets the age of the back buffer of the surface
+   * @return The buffer age, or 0 if the contents of the back buffer are undefined
+   */
+  int32_t GetBufferAge();
+
+  /**
+   * @brief Sets the area of the surface redrawn in the current frame; this is passed to the surface before it is presented
+   * @param[in] damagedRect The damaged area, or an empty rectangle if the whole surface was redrawn
+   */
+  void SetDamagedRect( const Rect<int32_t>& damagedRect );
+
+  /**
+   * @brief Queries whether the whole surface has to be redrawn, regardless of what changed in the scene
+   * @note This is reset by calling this method
+   * @return True if the size or background color have changed since the last call
+   */
+  bool IsFullRedrawRequired();
+
+  /**
+   * @brief Gets the areas covered by each render item in the last frame rendered to this surface
+   * @return The render item areas, sorted by node and renderer
+   */
+  ItemRectContainer& GetItemRects();
+
+  /**
+   * @brief Gets the damaged areas of the last frames rendered to this surface
+   * @return The damaged areas, the most recent first
+   */
+  DamagedRectContainer& GetDamagedRectHistory();
+
+  /**
+   * @brief Forgets the render items and damaged areas recorded for this surface
+   * @note The whole surface is redrawn in the next frame which records them again
+   */
+  void ResetDamage();
+
 private:
 
   Integration::RenderSurface* mSurface;   ///< The render surface
@@ -143,7 +204,11 @@ private:
   uint32_t                    mWidth;
   uint32_t                    mHeight;
   Vector4                     mBackgroundColor;
+  Rect<int32_t>               mDamagedRect;       ///< The area of the surface redrawn in the current frame
+  ItemRectContainer           mItemRects;         ///< The areas covered by each render item in the last frame
+  DamagedRectContainer        mDamagedRectHistory;///< The damaged areas of the last frames, the most recent first
   bool                        mSizeChanged;
+  bool                        mFullRedrawRequired;///< Whether the whole surface must be redrawn in the next frame
   std::atomic<bool>           mIsSurfaceInvalid; ///< This is set only from the event thread and read only from the render thread
 };
 
@@ -637,7 +637,8 @@ Texture::Texture( Type type, Pixel::Format format, ImageDimensions size )
   mMaxMipMapLevel( 0 ),
   mType( type ),
   mHasAlpha( HasAlpha( format ) ),
-  mIsCompressed( IsCompressedFormat( format ) )
+  mIsCompressed( IsCompressedFormat( format ) ),
+  mUpdated( true )
 {
   PixelFormatToGl( format,
                    mGlFormat,
@@ -658,7 +659,8 @@ Texture::Texture( NativeImageInterfacePtr nativeImageInterface )
   mMaxMipMapLevel( 0 ),
   mType( TextureType::TEXTURE_2D ),
   mHasAlpha( nativeImageInterface->RequiresBlending() ),
-  mIsCompressed( false )
+  mIsCompressed( false ),
+  mUpdated( true )
 {
 }
 
@@ -763,6 +765,8 @@ void Texture::Upload( Context& context, PixelDataPtr pixelData, const Internal::
 {
   DALI_ASSERT_ALWAYS( mNativeImage == NULL );
 
+  mUpdated = true;
+
   //Get pointer to the data of the PixelData object
   uint8_t* buffer( pixelData->GetBuffer() );
 
@@ -923,6 +927,8 @@ void Texture::GenerateMipmaps( Context& context )
   mMaxMipMapLevel = 0;
   context.BindTexture( mTarget, mId );
   context.GenerateMipmap( mTarget );
+
+  mUpdated = true;
 }
 
 } //Render
@@ -146,6 +146,24 @@ public:
     return mNativeImage;
   }
 
+  /**
+   * Check if the contents of the texture have changed since they were last presented
+   * @note Native images can change at any time, so they are always considered updated
+   * @return True if data has been uploaded or mipmaps generated since the last call to ResetUpdated()
+   */
+  bool IsUpdated() const
+  {
+    return mUpdated || mNativeImage;
+  }
+
+  /**
+   * Called from RenderManager once the current contents of the texture have been presented
+   */
+  void ResetUpdated()
+  {
+    mUpdated = false;
+  }
+
 private:
 
   /**
@@ -168,6 +186,7 @@ private:
   Type mType:3;                         ///< Type of the texture
   bool mHasAlpha : 1;                   ///< Whether the format has an alpha channel
   bool mIsCompressed : 1;               ///< Whether the format is compressed
+  bool mUpdated : 1;                    ///< Whether the contents have changed since they were last presented
 
 };
 
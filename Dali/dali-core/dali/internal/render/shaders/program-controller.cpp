@@ -34,6 +34,7 @@ ProgramController::ProgramController( Integration::GlAbstraction& glAbstraction
 : mShaderSaver( 0 ),
   mGlAbstraction( glAbstraction ),
   mCurrentProgram( NULL ),
+  mProgramBindCount( 0u ),
   mProgramBinaryFormat( 0 ),
   mNumberOfProgramBinaryFormats( 0 )
 {
@@ -126,6 +127,10 @@ Program* ProgramController::GetCurrentProgram()
 
 void ProgramController::SetCurrentProgram( Program* program )
 {
+  if( program )
+  {
+    ++mProgramBindCount;
+  }
   mCurrentProgram = program;
 }
 
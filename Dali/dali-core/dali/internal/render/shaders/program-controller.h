@@ -129,6 +129,23 @@ public: // API
    */
   void ClearCurrentProgram();
 
+  /**
+   * Get the number of times a program has been taken into use since the last call to ResetProgramBindCount()
+   * @return The number of program binds
+   */
+  uint32_t GetProgramBindCount() const
+  {
+    return mProgramBindCount;
+  }
+
+  /**
+   * Reset the number of program binds, e.g. at the beginning of a frame
+   */
+  void ResetProgramBindCount()
+  {
+    mProgramBindCount = 0u;
+  }
+
 private: // From ProgramCache
 
   /**
@@ -181,6 +198,7 @@ private: // Data
   ShaderSaver* mShaderSaver;
   Integration::GlAbstraction& mGlAbstraction;
   Program* mCurrentProgram;
+  uint32_t mProgramBindCount; ///< Number of times a program has been taken into use
 
   typedef OwnerContainer< ProgramPair* > ProgramContainer;
   typedef ProgramContainer::Iterator ProgramIterator;
@@ -81,6 +81,20 @@ const char* gStdAttribs[ Program::ATTRIB_TYPE_LAST ] =
 {
   "aPosition",    // ATTRIB_POSITION
   "aTexCoord",    // ATTRIB_TEXCOORD
+  "aInstanceMvpMatrix", // ATTRIB_INSTANCE_MVP_MATRIX
+  "aInstanceColor",     // ATTRIB_INSTANCE_COLOR
+};
+
+const char* gStdUniformBlocks[ Program::UNIFORM_BLOCK_TYPE_LAST ] =
+{
+  "DaliCameraBlock", // UNIFORM_BLOCK_CAMERA
+  "DaliItemBlock",   // UNIFORM_BLOCK_ITEM
+};
+
+const uint32_t gStdUniformBlockSizes[ Program::UNIFORM_BLOCK_TYPE_LAST ] =
+{
+  Program::CAMERA_UNIFORM_BLOCK_SIZE, // UNIFORM_BLOCK_CAMERA
+  Program::ITEM_UNIFORM_BLOCK_SIZE,   // UNIFORM_BLOCK_ITEM
 };
 
 const char* gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
@@ -161,6 +175,52 @@ uint32_t Program::RegisterCustomAttribute( const std::string& name )
   return index;
 }
 
+bool Program::IsInstancingSupported()
+{
+  // The attribute location is queried again while it is unknown, so the result is cached here
+  if( mInstancingSupported < 0 && mLinked )
+  {
+    mInstancingSupported = ( GetAttribLocation( ATTRIB_INSTANCE_MVP_MATRIX ) != ATTRIB_UNKNOWN ) ? 1 : 0;
+  }
+  return mInstancingSupported > 0;
+}
+
+bool Program::IsUniformBlockSupported()
+{
+  if( mUniformBlockSupported < 0 && mLinked )
+  {
+    GLuint blockIndices[ UNIFORM_BLOCK_TYPE_LAST ];
+    bool supported = true;
+    for( uint32_t i = 0; i < UNIFORM_BLOCK_TYPE_LAST && supported; ++i )
+    {
+      LOG_GL( "GetUniformBlockIndex(program=%d,%s)\n", mProgramId, gStdUniformBlocks[ i ] );
+      CHECK_GL( mGlAbstraction, blockIndices[ i ] = mGlAbstraction.GetUniformBlockIndex( mProgramId, gStdUniformBlocks[ i ] ) );
+      supported = ( blockIndices[ i ] != GL_INVALID_INDEX );
+      if( supported )
+      {
+        GLint blockSize( 0 );
+        CHECK_GL( mGlAbstraction, mGlAbstraction.GetActiveUniformBlockiv( mProgramId, blockIndices[ i ], GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize ) );
+        // Drivers may or may not pad the trailing vec3 of the item block to a vec4
+        supported = ( ( ( static_cast<uint32_t>( blockSize ) + 15u ) & ~15u ) == gStdUniformBlockSizes[ i ] );
+        if( !supported )
+        {
+          DALI_LOG_ERROR( "Uniform block %s has size %d, expected %u; using uniforms instead\n", gStdUniformBlocks[ i ], blockSize, gStdUniformBlockSizes[ i ] );
+        }
+      }
+    }
+
+    if( supported )
+    {
+      for( uint32_t i = 0; i < UNIFORM_BLOCK_TYPE_LAST; ++i )
+      {
+        CHECK_GL( mGlAbstraction, mGlAbstraction.UniformBlockBinding( mProgramId, blockIndices[ i ], i ) );
+      }
+    }
+    mUniformBlockSupported = supported ? 1 : 0;
+  }
+  return mUniformBlockSupported > 0;
+}
+
 GLint Program::GetCustomAttributeLocation( uint32_t attributeIndex )
 {
   // debug check that index is within name cache
@@ -594,6 +654,8 @@ Program::Program( ProgramCache& cache, Internal::ShaderDataPtr shaderData, bool
   mFragmentShaderId( 0 ),
   mProgramId( 0 ),
   mProgramData(shaderData),
+  mInstancingSupported( -1 ),
+  mUniformBlockSupported( -1 ),
   mModifiesGeometry( modifiesGeometry )
 {
   // reserve space for standard attributes
@@ -835,6 +897,9 @@ void Program::ResetAttribsUniformCache()
 
   mSamplerUniformLocations.clear();
 
+  mInstancingSupported = -1;
+  mUniformBlockSupported = -1;
+
   // reset uniform caches
   mSizeUniformCache.x = mSizeUniformCache.y = mSizeUniformCache.z = 0.f;
 
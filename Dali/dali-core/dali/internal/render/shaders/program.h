@@ -73,6 +73,8 @@ public:
     ATTRIB_UNKNOWN = -1,
     ATTRIB_POSITION,
     ATTRIB_TEXCOORD,
+    ATTRIB_INSTANCE_MVP_MATRIX,
+    ATTRIB_INSTANCE_COLOR,
     ATTRIB_TYPE_LAST
   };
 
@@ -98,6 +100,30 @@ public:
     UNIFORM_TYPE_LAST
   };
 
+  /**
+   * Uniform blocks which can replace the standard uniforms on OpenGL ES 3.0.
+   * The value is the binding point of the block. Both blocks use the std140 layout:
+   *
+   *   layout(std140) uniform DaliCameraBlock { mat4 uViewMatrix; mat4 uProjection; };
+   *   layout(std140) uniform DaliItemBlock { mat4 uModelMatrix; mat4 uModelView; mat4 uMvpMatrix; vec4 uColor; vec3 uSize; };
+   */
+  enum UniformBlockType
+  {
+    UNIFORM_BLOCK_CAMERA,
+    UNIFORM_BLOCK_ITEM,
+    UNIFORM_BLOCK_TYPE_LAST
+  };
+
+  /**
+   * Size in bytes of the std140 DaliCameraBlock uniform block
+   */
+  static const uint32_t CAMERA_UNIFORM_BLOCK_SIZE = 2u * 16u * sizeof( float );
+
+  /**
+   * Size in bytes of the std140 DaliItemBlock uniform block
+   */
+  static const uint32_t ITEM_UNIFORM_BLOCK_SIZE = ( 3u * 16u + 4u + 4u ) * sizeof( float );
+
   /**
    * Creates a new program, or returns a copy of an existing program in the program cache
    * @param[in] cache where the programs are stored
@@ -132,6 +158,21 @@ public:
    */
   uint32_t RegisterCustomAttribute( const std::string& name );
 
+  /**
+   * Checks whether the program can be used for instanced drawing, i.e. whether its vertex shader
+   * reads the model-view-projection matrix of each instance from the aInstanceMvpMatrix attribute.
+   * @return true if the program supports instanced drawing
+   */
+  bool IsInstancingSupported();
+
+  /**
+   * Checks whether the program reads the standard uniforms from the DaliCameraBlock and DaliItemBlock uniform blocks.
+   * The blocks are bound to their binding points the first time this is called after linking.
+   * @pre The context supports OpenGL ES 3.0
+   * @return true if the program declares both uniform blocks with the expected size
+   */
+  bool IsUniformBlockSupported();
+
   /**
    * Gets the location of a pre-registered attribute.
    * @param [in] attributeIndex of the attribute in local cache
@@ -386,6 +427,8 @@ private:  // Data
   GLfloat mUniformCacheFloat2[ MAX_UNIFORM_CACHE_SIZE ][2]; ///< Value cache for uniforms of two floats
   GLfloat mUniformCacheFloat4[ MAX_UNIFORM_CACHE_SIZE ][4]; ///< Value cache for uniforms of four floats
   Vector3 mSizeUniformCache;                                ///< Cache value for size uniform
+  int8_t mInstancingSupported;                              ///< Whether the program supports instanced drawing, -1 if not queried yet
+  int8_t mUniformBlockSupported;                            ///< Whether the program uses the standard uniform blocks, -1 if not queried yet
   bool mModifiesGeometry;  ///< True if the program changes geometry
 
 };
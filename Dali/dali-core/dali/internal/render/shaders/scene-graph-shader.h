@@ -22,6 +22,7 @@
 #include <dali/internal/common/shader-data.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/scene-graph-connection-change-propagator.h>
+#include <dali/internal/update/common/scene-graph-container-index.h>
 
 
 namespace Dali
@@ -40,7 +41,7 @@ class SceneController;
 /**
  * A holder class for Program; also enables sharing of uniform properties
  */
-class Shader : public PropertyOwner, public UniformMap::Observer
+class Shader : public PropertyOwner, public UniformMap::Observer, public ContainerIndex
 {
 public:
 
@@ -302,7 +302,7 @@ void Animation::AddAnimator( OwnerPointer<AnimatorBase>& animator )
   mAnimators.PushBack( animator.Release() );
 }
 
-void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached )
+void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached, AnimatorUpdateContainer* animatorUpdates )
 {
   looped = false;
   finished = false;
@@ -378,7 +378,7 @@ void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& loo
 
           // Make elapsed second as edge of range forcely.
           mElapsedSeconds = edgeRangeSeconds + signSpeedFactor * Math::MACHINE_EPSILON_10;
-          UpdateAnimators(bufferIndex, finished && (mEndAction != Dali::Animation::Discard), finished );
+          UpdateAnimators(bufferIndex, finished && (mEndAction != Dali::Animation::Discard), finished, animatorUpdates );
 
           // After update animation, mElapsedSeconds must be begin of value
           mElapsedSeconds = playRangeStartSeconds + playRangeEndSeconds - edgeRangeSeconds;
@@ -420,11 +420,11 @@ void Animation::Update( BufferIndex bufferIndex, float elapsedSeconds, bool& loo
   // Already updated when finished. So skip.
   if( !finished )
   {
-    UpdateAnimators(bufferIndex, false, false );
+    UpdateAnimators(bufferIndex, false, false, animatorUpdates );
   }
 }
 
-void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished )
+void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished, AnimatorUpdateContainer* animatorUpdates )
 {
   const Vector2 playRange( mPlayRange * mDurationSeconds );
   float elapsedSecondsClamped = Clamp( mElapsedSeconds, playRange.x, playRange.y );
@@ -455,7 +455,15 @@ void Animation::UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animat
           {
             progress = Clamp((elapsedSecondsClamped - intervalDelay) / animatorDuration, 0.0f , 1.0f );
           }
-          animator->Update(bufferIndex, progress, bake);
+          if( animatorUpdates )
+          {
+            const AnimatorUpdate update = { animator, progress, bake };
+            animatorUpdates->PushBack( update );
+          }
+          else
+          {
+            animator->Update(bufferIndex, progress, bake);
+          }
         }
         applied = true;
       }
@@ -40,6 +40,18 @@ namespace SceneGraph
  * managers "update" phase. An animation is a container of Animator objects; the actual setting
  * of object values is done by the animators.
  */
+/**
+ * An update of an animator, recorded so that the animators of all the animations can be applied together.
+ */
+struct AnimatorUpdate
+{
+  AnimatorBase* animator; ///< The animator to update
+  float progress;         ///< The progress of the animator, from 0 to 1
+  bool bake;              ///< Whether the result is baked
+};
+
+typedef Dali::Vector< AnimatorUpdate > AnimatorUpdateContainer;
+
 class Animation
 {
 public:
@@ -283,8 +295,9 @@ public:
    * @param[out] looped True if the animation looped
    * @param[out] finished True if the animation has finished.
    * @param[out] progressReached True if progress marker reached
+   * @param[out] animatorUpdates If not null, the animator updates are added to this container instead of being applied
    */
-  void Update(BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached );
+  void Update(BufferIndex bufferIndex, float elapsedSeconds, bool& looped, bool& finished, bool& progressReached, AnimatorUpdateContainer* animatorUpdates = nullptr );
 
 
 protected:
@@ -302,8 +315,9 @@ private:
    * @param[in] bufferIndex The buffer to update.
    * @param[in] bake True if the final result should be baked.
    * @param[in] animationFinished True if the animation has finished.
+   * @param[out] animatorUpdates If not null, the animator updates are added to this container instead of being applied.
    */
-  void UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished );
+  void UpdateAnimators( BufferIndex bufferIndex, bool bake, bool animationFinished, AnimatorUpdateContainer* animatorUpdates = nullptr );
 
   /**
    * Helper function to bake the result of the animation when it is stopped or
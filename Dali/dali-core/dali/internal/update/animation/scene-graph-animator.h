@@ -505,6 +505,15 @@ public:
     return (mPropertyOwner == nullptr);
   }
 
+  /**
+   * Retrieve the scene object which owns the animated property.
+   * @return The property owner, or nullptr if the animator is orphan
+   */
+  PropertyOwner* GetPropertyOwner() const
+  {
+    return mPropertyOwner;
+  }
+
   /**
    * Update the scene object attached to the animator.
    * @param[in] bufferIndex The buffer to animate.
@@ -1024,7 +1033,7 @@ struct RotateToQuaternion : public AnimatorFunctionBase
 struct KeyFrameBooleanFunctor : public AnimatorFunctionBase
 {
   KeyFrameBooleanFunctor(KeyFrameBooleanPtr keyFrames)
-  : mKeyFrames(keyFrames)
+  : mKeyFrames(keyFrames),mSegment(0u)
   {
   }
 
@@ -1033,18 +1042,19 @@ struct KeyFrameBooleanFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, Dali::Animation::Linear);
+      return mKeyFrames->GetValue(progress, Dali::Animation::Linear, mSegment);
     }
     return property;
   }
 
   KeyFrameBooleanPtr mKeyFrames;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct KeyFrameIntegerFunctor : public AnimatorFunctionBase
 {
   KeyFrameIntegerFunctor(KeyFrameIntegerPtr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mSegment(0u)
   {
   }
 
@@ -1053,19 +1063,20 @@ struct KeyFrameIntegerFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return static_cast<float>( mKeyFrames->GetValue(progress, mInterpolation) );
+      return static_cast<float>( mKeyFrames->GetValue(progress, mInterpolation, mSegment) );
     }
     return static_cast<float>( property );
   }
 
   KeyFrameIntegerPtr mKeyFrames;
   Interpolation mInterpolation;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct KeyFrameNumberFunctor : public AnimatorFunctionBase
 {
   KeyFrameNumberFunctor(KeyFrameNumberPtr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mSegment(0u)
   {
   }
 
@@ -1074,19 +1085,20 @@ struct KeyFrameNumberFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mSegment);
     }
     return property;
   }
 
   KeyFrameNumberPtr mKeyFrames;
   Interpolation mInterpolation;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct KeyFrameVector2Functor : public AnimatorFunctionBase
 {
   KeyFrameVector2Functor(KeyFrameVector2Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mSegment(0u)
   {
   }
 
@@ -1095,20 +1107,21 @@ struct KeyFrameVector2Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mSegment);
     }
     return property;
   }
 
   KeyFrameVector2Ptr mKeyFrames;
   Interpolation mInterpolation;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 
 struct KeyFrameVector3Functor : public AnimatorFunctionBase
 {
   KeyFrameVector3Functor(KeyFrameVector3Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mSegment(0u)
   {
   }
 
@@ -1117,19 +1130,20 @@ struct KeyFrameVector3Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mSegment);
     }
     return property;
   }
 
   KeyFrameVector3Ptr mKeyFrames;
   Interpolation mInterpolation;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct KeyFrameVector4Functor : public AnimatorFunctionBase
 {
   KeyFrameVector4Functor(KeyFrameVector4Ptr keyFrames, Interpolation interpolation)
-  : mKeyFrames(keyFrames),mInterpolation(interpolation)
+  : mKeyFrames(keyFrames),mInterpolation(interpolation),mSegment(0u)
   {
   }
 
@@ -1138,19 +1152,20 @@ struct KeyFrameVector4Functor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, mInterpolation);
+      return mKeyFrames->GetValue(progress, mInterpolation, mSegment);
     }
     return property;
   }
 
   KeyFrameVector4Ptr mKeyFrames;
   Interpolation mInterpolation;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct KeyFrameQuaternionFunctor : public AnimatorFunctionBase
 {
   KeyFrameQuaternionFunctor(KeyFrameQuaternionPtr keyFrames)
-  : mKeyFrames(keyFrames)
+  : mKeyFrames(keyFrames),mSegment(0u)
   {
   }
 
@@ -1159,12 +1174,13 @@ struct KeyFrameQuaternionFunctor : public AnimatorFunctionBase
   {
     if(mKeyFrames->IsActive(progress))
     {
-      return mKeyFrames->GetValue(progress, Dali::Animation::Linear);
+      return mKeyFrames->GetValue(progress, Dali::Animation::Linear, mSegment);
     }
     return property;
   }
 
   KeyFrameQuaternionPtr mKeyFrames;
+  std::size_t mSegment; ///< The key frame interval found by the previous update
 };
 
 struct PathPositionFunctor : public AnimatorFunctionBase
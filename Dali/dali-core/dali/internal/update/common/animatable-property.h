@@ -2136,8 +2136,8 @@ void BakeMessage( EventThreadServices& eventThreadServices,
 {
   typedef MessageDoubleBuffered1< SceneGraph::AnimatableProperty<T>, T > LocalType;
 
-  // Reserve some memory inside the message queue
-  uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+  // Reserve some memory inside the message queue; a pending bake of the same property may be replaced
+  uint32_t* slot = eventThreadServices.ReserveCoalescableMessageSlot( &property, sizeof( LocalType ) );
 
   // Construct message in the message queue memory; note that delete should not be called on the return value
   new (slot) LocalType( &property,
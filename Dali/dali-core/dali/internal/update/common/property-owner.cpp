@@ -116,6 +116,18 @@ void PropertyOwner::InstallCustomProperty( OwnerPointer<PropertyBase>& property
 }
 
 
+bool PropertyOwner::IsAnyCustomPropertyDirty() const
+{
+  for( auto&& property : mCustomProperties )
+  {
+    if( !property->IsClean() )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 ConstraintOwnerContainer& PropertyOwner::GetConstraints()
 {
   return mConstraints;
@@ -160,6 +160,12 @@ public:
     return mCustomProperties;
   }
 
+  /**
+   * Query whether any of the custom properties has been set, baked or animated recently.
+   * @return True if any custom property is dirty.
+   */
+  bool IsAnyCustomPropertyDirty() const;
+
 
   // Constraints
 
@@ -0,0 +1,87 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_CONTAINER_INDEX_H
+#define DALI_INTERNAL_SCENE_GRAPH_CONTAINER_INDEX_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint> // uint32_t
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Stores the position of a scene graph object in the container of its owner (the UpdateManager),
+ * so it can be removed from that container in constant time.
+ */
+class ContainerIndex
+{
+public:
+
+  static const uint32_t INVALID_CONTAINER_INDEX = 0xFFFFFFFF;
+
+  /**
+   * Constructor
+   */
+  ContainerIndex()
+  : mContainerIndex( INVALID_CONTAINER_INDEX )
+  {
+  }
+
+  /**
+   * Set the position of the object in the container of its owner
+   * @param[in] index The position, or INVALID_CONTAINER_INDEX if the object is not in a container
+   */
+  void SetContainerIndex( uint32_t index )
+  {
+    mContainerIndex = index;
+  }
+
+  /**
+   * Get the position of the object in the container of its owner
+   * @return The position, or INVALID_CONTAINER_INDEX if the object is not in a container
+   */
+  uint32_t GetContainerIndex() const
+  {
+    return mContainerIndex;
+  }
+
+protected:
+
+  /**
+   * Protected destructor; ContainerIndex is not deleted through a base pointer.
+   */
+  ~ContainerIndex() = default;
+
+private:
+
+  uint32_t mContainerIndex; ///< Position in the container of the owner
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_CONTAINER_INDEX_H
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/update/common/scene-graph-property-notification-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+PropertyNotificationIndex::PropertyNotificationIndex()
+: mGroups(),
+  mNotified(),
+  mCheckedCount( 0u ),
+  mDirty( true )
+{
+}
+
+PropertyNotificationIndex::~PropertyNotificationIndex()
+{
+}
+
+void PropertyNotificationIndex::SetDirty()
+{
+  mDirty = true;
+}
+
+void PropertyNotificationIndex::Check( const PropertyNotificationContainer& notifications, BufferIndex bufferIndex, Vector< PropertyNotification* >& notified )
+{
+  if( mDirty )
+  {
+    Rebuild( notifications );
+  }
+
+  mCheckedCount = 0u;
+  for( auto&& group : mGroups )
+  {
+    if( group.checkAll || group.property->InputChanged() )
+    {
+      for( auto&& entry : group.notifications )
+      {
+        CheckNotification( entry, bufferIndex );
+      }
+
+      if( !group.intervals.Empty() )
+      {
+        const float key = group.intervals[0].notification->GetIntervalKey( bufferIndex );
+        if( group.checkAll || std::isnan( key ) || std::isnan( group.key ) )
+        {
+          for( auto&& entry : group.intervals )
+          {
+            CheckNotification( entry, bufferIndex );
+          }
+        }
+        else if( key != group.key )
+        {
+          // Only the conditions with a bound between the previous and the current key can change.
+          // A condition with both bounds in the range is checked twice; the second check cannot notify.
+          const auto compare = []( const Bound& bound, float value ) { return bound.value < value; };
+          auto iter = std::lower_bound( group.bounds.Begin(), group.bounds.End(), std::min( key, group.key ), compare );
+          const float maximum = std::max( key, group.key );
+          for( ; iter != group.bounds.End() && iter->value <= maximum; ++iter )
+          {
+            CheckNotification( iter->entry, bufferIndex );
+          }
+        }
+        group.key = key;
+      }
+      group.checkAll = false;
+    }
+    else
+    {
+      for( auto&& entry : group.notifications )
+      {
+        if( entry.notification->IsCheckRequired() )
+        {
+          CheckNotification( entry, bufferIndex );
+        }
+      }
+    }
+  }
+
+  // The groups are ordered by property; send the notifications in the order they were added, as when all were checked
+  std::sort( mNotified.Begin(), mNotified.End(), []( const Entry& lhs, const Entry& rhs ) { return lhs.order < rhs.order; } );
+  for( auto&& entry : mNotified )
+  {
+    notified.PushBack( entry.notification );
+  }
+  mNotified.Clear();
+}
+
+void PropertyNotificationIndex::Rebuild( const PropertyNotificationContainer& notifications )
+{
+  // Keep the order in which the notifications were added within each property
+  std::vector< Entry > sorted;
+  sorted.reserve( notifications.Count() );
+  for( auto&& notification : notifications )
+  {
+    sorted.push_back( Entry{ notification, static_cast<uint32_t>( sorted.size() ) } );
+  }
+  std::stable_sort( sorted.begin(), sorted.end(), []( const Entry& lhs, const Entry& rhs )
+  {
+    return ( lhs.notification->GetProperty() < rhs.notification->GetProperty() ) ||
+           ( ( lhs.notification->GetProperty() == rhs.notification->GetProperty() ) &&
+             ( lhs.notification->GetComponentIndex() < rhs.notification->GetComponentIndex() ) );
+  } );
+
+  mGroups.clear();
+  for( auto&& entry : sorted )
+  {
+    PropertyNotification* notification = entry.notification;
+    if( mGroups.empty() ||
+        mGroups.back().property != notification->GetProperty() ||
+        mGroups.back().componentIndex != notification->GetComponentIndex() )
+    {
+      mGroups.push_back( Group() );
+      Group& group = mGroups.back();
+      group.property = notification->GetProperty();
+      group.componentIndex = notification->GetComponentIndex();
+      group.key = 0.0f;
+      group.checkAll = true;
+    }
+
+    Group& group = mGroups.back();
+    float lower, upper;
+    if( notification->GetInterval( lower, upper ) && !std::isnan( lower ) && !std::isnan( upper ) )
+    {
+      group.intervals.PushBack( entry );
+      group.bounds.PushBack( Bound{ lower, entry } );
+      group.bounds.PushBack( Bound{ upper, entry } );
+    }
+    else
+    {
+      group.notifications.PushBack( entry );
+    }
+  }
+
+  for( auto&& group : mGroups )
+  {
+    std::sort( group.bounds.Begin(), group.bounds.End(), []( const Bound& lhs, const Bound& rhs ) { return lhs.value < rhs.value; } );
+  }
+
+  mDirty = false;
+}
+
+void PropertyNotificationIndex::CheckNotification( const Entry& entry, BufferIndex bufferIndex )
+{
+  if( entry.notification->Check( bufferIndex ) )
+  {
+    mNotified.PushBack( entry );
+  }
+  ++mCheckedCount;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,142 @@
+#ifndef DALI_INTERNAL_SCENE_GRAPH_PROPERTY_NOTIFICATION_INDEX_H
+#define DALI_INTERNAL_SCENE_GRAPH_PROPERTY_NOTIFICATION_INDEX_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/update/common/scene-graph-property-notification.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * Groups the property notifications by the property they inspect, so that only the notifications
+ * of the properties that changed in the current frame are checked.
+ * The Inside and Outside conditions of a float or vector property are also sorted by their bounds;
+ * when the property changes, only the conditions with a bound between the previous and the current
+ * value can change their result, so only those are checked.
+ */
+class PropertyNotificationIndex
+{
+public:
+
+  /**
+   * Constructor
+   */
+  PropertyNotificationIndex();
+
+  /**
+   * Destructor
+   */
+  ~PropertyNotificationIndex();
+
+  /**
+   * Called when a notification has been added to or removed from the container of the UpdateManager.
+   * The index is rebuilt before the next check, and the notifications are all checked in that frame.
+   */
+  void SetDirty();
+
+  /**
+   * Checks the notifications whose property may have changed.
+   * This must be called after the TransformManager has been updated.
+   * @param[in] notifications All the property notifications
+   * @param[in] bufferIndex The current update buffer index.
+   * @param[out] notified The notifications which have to be sent to the event thread, in the order they were added
+   */
+  void Check( const PropertyNotificationContainer& notifications, BufferIndex bufferIndex, Vector< PropertyNotification* >& notified );
+
+  /**
+   * Retrieve the number of notifications checked in the last call to Check()
+   * @return The number of notifications checked
+   */
+  uint32_t GetCheckedCount() const
+  {
+    return mCheckedCount;
+  }
+
+private:
+
+  /**
+   * Rebuilds the groups from the notifications
+   * @param[in] notifications All the property notifications
+   */
+  void Rebuild( const PropertyNotificationContainer& notifications );
+
+  /**
+   * A notification and its position in the container of the UpdateManager
+   */
+  struct Entry
+  {
+    PropertyNotification* notification;         ///< The notification
+    uint32_t order;                             ///< The position of the notification, which is the order it was added in
+  };
+
+  /**
+   * A bound of an Inside or Outside condition
+   */
+  struct Bound
+  {
+    float value;                                ///< The bound, in the units of PropertyNotification::GetIntervalKey()
+    Entry entry;                                ///< The notification of the condition
+  };
+
+  /**
+   * Checks a notification and records it if it has to be sent to the event thread
+   * @param[in] entry The notification
+   * @param[in] bufferIndex The current update buffer index.
+   */
+  void CheckNotification( const Entry& entry, BufferIndex bufferIndex );
+
+  /**
+   * The notifications of a property (or a component of a property)
+   */
+  struct Group
+  {
+    const PropertyInputImpl* property;          ///< The property inspected
+    int componentIndex;                         ///< The component inspected
+    Vector< Entry > notifications;              ///< Notifications checked whenever the property changes
+    Vector< Entry > intervals;                  ///< Notifications with an Inside or Outside condition
+    Vector< Bound > bounds;                     ///< The bounds of the intervals, sorted by value
+    float key;                                  ///< The key of the intervals in the last check
+    bool checkAll;                              ///< Whether all the notifications have to be checked, regardless of the property
+  };
+
+  std::vector< Group > mGroups;                 ///< The groups of notifications
+  Vector< Entry > mNotified;                    ///< The notifications to send, found in the current check
+  uint32_t mCheckedCount;                       ///< The number of notifications checked in the last check
+  bool mDirty;                                  ///< Whether the groups have to be rebuilt
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SCENE_GRAPH_PROPERTY_NOTIFICATION_INDEX_H
@@ -185,6 +185,88 @@ bool PropertyNotification::GetValidity() const
   return mValid;
 }
 
+const PropertyInputImpl* PropertyNotification::GetProperty() const
+{
+  return mProperty;
+}
+
+int PropertyNotification::GetComponentIndex() const
+{
+  return mComponentIndex;
+}
+
+bool PropertyNotification::IsCheckRequired() const
+{
+  return mValid && ( ( mConditionType == PropertyCondition::Step ) || ( mConditionType == PropertyCondition::VariableStep ) );
+}
+
+bool PropertyNotification::GetInterval( float& lower, float& upper ) const
+{
+  if( ( mConditionType != PropertyCondition::Inside ) && ( mConditionType != PropertyCondition::Outside ) )
+  {
+    return false;
+  }
+
+  switch( mPropertyType )
+  {
+    case Property::FLOAT:
+    {
+      lower = mArguments[0];
+      upper = mArguments[1];
+      return true;
+    }
+    case Property::VECTOR2:
+    case Property::VECTOR3:
+    case Property::VECTOR4:
+    {
+      if( Property::INVALID_COMPONENT_INDEX != mComponentIndex )
+      {
+        return false;
+      }
+
+      // Same as the condition functions, which compare the squared length
+      lower = mArguments[0] * mArguments[0];
+      upper = mArguments[1] * mArguments[1];
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+float PropertyNotification::GetIntervalKey( BufferIndex bufferIndex ) const
+{
+  if ( Property::INVALID_COMPONENT_INDEX != mComponentIndex )
+  {
+    const PropertyInputAccessor component( mProperty, mComponentIndex );
+    const PropertyInputIndexer< PropertyInputAccessor > input( bufferIndex, &component );
+    return input.GetFloat();
+  }
+
+  const PropertyInputIndexer< PropertyInputImpl > input( bufferIndex, mProperty );
+  switch( mPropertyType )
+  {
+    case Property::VECTOR2:
+    {
+      return input.GetVector2().LengthSquared();
+    }
+    case Property::VECTOR3:
+    {
+      return input.GetVector3().LengthSquared();
+    }
+    case Property::VECTOR4:
+    {
+      return input.GetVector4().LengthSquared();
+    }
+    default:
+    {
+      return input.GetFloat();
+    }
+  }
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
@@ -103,6 +103,43 @@ public:
    */
   bool GetValidity() const;
 
+  /**
+   * Retrieve the scene graph property being inspected
+   * @return The property
+   */
+  const PropertyInputImpl* GetProperty() const;
+
+  /**
+   * Retrieve the component of the property being inspected
+   * @return The component index, or Property::INVALID_COMPONENT_INDEX
+   */
+  int GetComponentIndex() const;
+
+  /**
+   * Queries whether the condition has to be checked although the property has not changed.
+   * This is the case for a Step or VariableStep condition that was met by the last check,
+   * as these are only met in the frame in which a step is crossed.
+   * @return true if the condition has to be checked
+   */
+  bool IsCheckRequired() const;
+
+  /**
+   * Retrieve the bounds of an Inside or Outside condition, in the units of GetIntervalKey().
+   * The result of the condition can only change when the key reaches or crosses one of the bounds.
+   * @param[out] lower The lower bound
+   * @param[out] upper The upper bound
+   * @return false if the condition is not an interval of a float or vector property
+   */
+  bool GetInterval( float& lower, float& upper ) const;
+
+  /**
+   * Retrieve the value compared with the bounds of the condition;
+   * the float value, or the squared length of a vector.
+   * @param[in] bufferIndex The current update buffer index.
+   * @return The key
+   */
+  float GetIntervalKey( BufferIndex bufferIndex ) const;
+
 protected:
 
   /**
@@ -18,6 +18,10 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/render-instruction-processor.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <limits>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/layer.h>
 #include <dali/integration-api/debug.h>
@@ -141,6 +145,36 @@ bool CompareItems3DWithClipping( const RenderInstructionProcessor::SortAttribute
   return lhs.renderItem->mNode->mClippingSortModifier < rhs.renderItem->mNode->mClippingSortModifier;
 }
 
+/**
+ * Function which sorts opaque render items by their packed render state key, and the others like CompareItems3D.
+ * @param[in] lhs Left hand side item
+ * @param[in] rhs Right hand side item
+ * @return True if left item is greater than right
+ */
+bool CompareItems3DByRenderState( const RenderInstructionProcessor::SortAttributes& lhs, const RenderInstructionProcessor::SortAttributes& rhs )
+{
+  if( lhs.renderItem->mIsOpaque && rhs.renderItem->mIsOpaque )
+  {
+    return lhs.sortKey < rhs.sortKey;
+  }
+  return CompareItems3D( lhs, rhs );
+}
+
+/**
+ * Fold the address of an object into the given number of bits for a sort key.
+ * Different objects may share the same bits; this only costs an extra render state change.
+ * @param[in] object The object
+ * @param[in] bits The number of bits
+ * @return The folded address
+ */
+inline uint64_t FoldPointer( const void* object, uint32_t bits )
+{
+  // Objects are at least 8 byte aligned, so the lowest bits carry no information
+  uint64_t value = static_cast<uint64_t>( reinterpret_cast<uintptr_t>( object ) ) >> 3u;
+  value ^= ( value >> bits ) ^ ( value >> ( 2u * bits ) );
+  return value & ( ( uint64_t( 1u ) << bits ) - 1u );
+}
+
 /**
  * Add a renderer to the list
  * @param updateBufferIndex to read the model matrix from
@@ -179,6 +213,7 @@ inline void AddRendererToRenderList( BufferIndex updateBufferIndex,
 
       item.mNode = renderable.mNode;
       item.mIsOpaque = ( opacityType == Renderer::OPAQUE );
+      item.mUpdated = node->Updated() || ( renderable.mRenderer && renderable.mRenderer->Updated() );
       item.mDepthIndex = 0;
 
       if(!isLayer3d)
@@ -244,71 +279,120 @@ inline void AddRenderersToRenderList( BufferIndex updateBufferIndex,
   }
 }
 
+/**
+ * Calculate a combined sum of all renderer and node addresses of the renderables.
+ * The renderables are sorted after they are added, so a sum is used which does not depend on the order.
+ * @param[in] renderables list of renderables
+ * @return The checksum
+ */
+inline std::size_t CalculateRenderablesChecksum( RenderableContainer& renderables )
+{
+  std::size_t checkSum = 0;
+  const uint32_t renderableCount = static_cast<uint32_t>( renderables.Size() );
+  for( uint32_t index = 0; index < renderableCount; ++index )
+  {
+    checkSum += reinterpret_cast<std::size_t>( &renderables[index].mRenderer->GetRenderer() );
+    checkSum += reinterpret_cast<std::size_t>( renderables[index].mNode );
+  }
+  return checkSum;
+}
+
+/**
+ * Check whether any of the renderables needs to be redrawn in a partial update.
+ * @param[in] renderables list of renderables
+ * @return True if any of the renderables has been updated
+ */
+inline bool IsAnyRenderableUpdated( RenderableContainer& renderables )
+{
+  const uint32_t renderableCount = static_cast<uint32_t>( renderables.Size() );
+  for( uint32_t index = 0; index < renderableCount; ++index )
+  {
+    if( renderables[index].mNode->Updated() || renderables[index].mRenderer->Updated() )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  * Try to reuse cached RenderItems from the RenderList
- * This avoids recalculating the model view matrices in case this part of the scene was static
+ * This avoids recalculating the model view matrices and sorting in case this part of the scene was static
  * An example case is a toolbar layer that rarely changes or a popup on top of the rest of the stage
  * @param layer that is being processed
  * @param renderList that is cached from frame N-1
  * @param renderables list of renderables
+ * @param checkSum The combined sum of the renderer and node addresses of the renderables
+ * @param updated True if any of the renderables needs to be redrawn in a partial update
  */
 inline bool TryReuseCachedRenderers( Layer& layer,
                                      RenderList& renderList,
-                                     RenderableContainer& renderables )
+                                     RenderableContainer& renderables,
+                                     std::size_t checkSum,
+                                     bool updated )
 {
-  bool retValue = false;
-  uint32_t renderableCount = static_cast<uint32_t>( renderables.Size() );
-  // Check that the cached list originates from this layer and that the counts match
-  if( ( renderList.GetSourceLayer() == &layer )&&
-      ( renderList.GetCachedItemCount() == renderableCount ) )
+  // Check that the cached list originates from this layer and was built from the same renderables.
+  // Culled and fully transparent renderables have no item, so the renderables are compared rather than the items;
+  // with an unchanged camera and clean transforms they are culled / skipped the same way again.
+  // With partial update, the cached items cannot be reused either if any of them needs to be redrawn, as they would not be marked as updated.
+  if( ( renderList.GetSourceLayer() == &layer ) &&
+      ( renderList.GetSourceRenderableCount() == static_cast<uint32_t>( renderables.Size() ) ) &&
+      ( renderList.GetSourceChecksum() == checkSum ) &&
+      !updated )
   {
-    // Check that all the same renderers are there. This gives us additional security in avoiding rendering the wrong things.
-    // Render list is sorted so at this stage renderers may be in different order.
-    // Therefore we check a combined sum of all renderer addresses.
-    size_t checkSumNew = 0;
-    size_t checkSumOld = 0;
-    for( uint32_t index = 0; index < renderableCount; ++index )
-    {
-      const Render::Renderer& renderer = renderables[index].mRenderer->GetRenderer();
-      checkSumNew += reinterpret_cast<std::size_t>( &renderer );
-      checkSumOld += reinterpret_cast<std::size_t>( &renderList.GetRenderer( index ) );
-    }
-    if( checkSumNew == checkSumOld )
+    // tell list to reuse its existing items
+    renderList.ReuseCachedItems();
+
+    // Nothing has changed since these items were created
+    const uint32_t itemCount = renderList.Count();
+    for( uint32_t index = 0; index < itemCount; ++index )
     {
-      // tell list to reuse its existing items
-      renderList.ReuseCachedItems();
-      retValue = true;
+      renderList.GetItem( index ).mUpdated = false;
     }
+    return true;
   }
-  return retValue;
+  return false;
 }
 
 inline bool SetupRenderList( RenderableContainer& renderables,
                              Layer& layer,
                              RenderInstruction& instruction,
                              bool tryReuseRenderList,
+                             bool partialUpdateAvailable,
                              RenderList** renderList )
 {
   *renderList = &( instruction.GetNextFreeRenderList( renderables.Size() ) );
   ( *renderList )->SetClipping( layer.IsClipping(), layer.GetClippingBox() );
   ( *renderList )->SetSourceLayer( &layer );
 
+  const std::size_t checkSum = CalculateRenderablesChecksum( renderables );
+
   // Try to reuse cached RenderItems from last time around.
-  return ( tryReuseRenderList && TryReuseCachedRenderers( layer, **renderList, renderables ) );
+  if( tryReuseRenderList &&
+      TryReuseCachedRenderers( layer, **renderList, renderables, checkSum, partialUpdateAvailable && IsAnyRenderableUpdated( renderables ) ) )
+  {
+    return true;
+  }
+
+  // The caller rebuilds the items from these renderables
+  ( *renderList )->SetSourceRenderables( static_cast<uint32_t>( renderables.Size() ), checkSum );
+  return false;
 }
 
 } // Anonymous namespace.
 
 
-RenderInstructionProcessor::RenderInstructionProcessor()
-: mSortingHelper()
+RenderInstructionProcessor::RenderInstructionProcessor( Integration::PartialUpdateAvailable partialUpdateAvailable )
+: mSortingHelper(),
+  mPartialUpdateAvailable( partialUpdateAvailable == Integration::PartialUpdateAvailable::TRUE )
 {
   // Set up a container of comparators for fast run-time selection.
-  mSortComparitors.Reserve( 3u );
+  mSortComparitors.Reserve( 4u );
 
   mSortComparitors.PushBack( CompareItems );
   mSortComparitors.PushBack( CompareItems3D );
   mSortComparitors.PushBack( CompareItems3DWithClipping );
+  mSortComparitors.PushBack( CompareItems3DByRenderState );
 }
 
 RenderInstructionProcessor::~RenderInstructionProcessor()
@@ -377,11 +461,28 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
     }
   }
 
-  // Here we determine which comparitor (of the 3) to use.
+  // Here we determine which comparitor (of the 4) to use.
   //   0 is LAYER_UI
   //   1 is LAYER_3D
   //   2 is LAYER_3D + Clipping
-  const unsigned int comparitorIndex = layer.GetBehavior() == Dali::Layer::LAYER_3D ? respectClippingOrder ? 2u : 1u : 0u;
+  //   3 is LAYER_3D sorted by render state
+  unsigned int comparitorIndex = 0u;
+  if( layer.GetBehavior() == Dali::Layer::LAYER_3D )
+  {
+    if( respectClippingOrder )
+    {
+      comparitorIndex = 2u;
+    }
+    else if( layer.IsSortByRenderState() )
+    {
+      CalculateRenderStateSortKeys( renderableCount );
+      comparitorIndex = 3u;
+    }
+    else
+    {
+      comparitorIndex = 1u;
+    }
+  }
 
   std::stable_sort( mSortingHelper.begin(), mSortingHelper.end(), mSortComparitors[ comparitorIndex ] );
 
@@ -395,6 +496,40 @@ inline void RenderInstructionProcessor::SortRenderItems( BufferIndex bufferIndex
   }
 }
 
+inline void RenderInstructionProcessor::CalculateRenderStateSortKeys( uint32_t count )
+{
+  // Key layout: shader (16 bits) | texture set (16 bits) | geometry (12 bits) | Z value (20 bits)
+  const uint32_t depthBits = 20u;
+  const float maxDepthKey = static_cast<float>( ( 1u << depthBits ) - 1u );
+
+  float minZ = std::numeric_limits<float>::max();
+  float maxZ = -std::numeric_limits<float>::max();
+  for( uint32_t index = 0; index < count; ++index )
+  {
+    const SortAttributes& attributes = mSortingHelper[ index ];
+    if( attributes.renderItem->mIsOpaque )
+    {
+      minZ = std::min( minZ, attributes.zValue );
+      maxZ = std::max( maxZ, attributes.zValue );
+    }
+  }
+  const float depthScale = ( maxZ > minZ ) ? maxDepthKey / ( maxZ - minZ ) : 0.0f;
+
+  for( uint32_t index = 0; index < count; ++index )
+  {
+    SortAttributes& attributes = mSortingHelper[ index ];
+    if( attributes.renderItem->mIsOpaque )
+    {
+      // Opaque items are drawn front to back, i.e. with increasing Z value, to reject hidden fragments early
+      const uint64_t depth = static_cast<uint64_t>( std::min( std::max( 0.0f, ( attributes.zValue - minZ ) * depthScale ), maxDepthKey ) );
+      attributes.sortKey = ( FoldPointer( attributes.shader, 16u ) << 48u ) |
+                           ( FoldPointer( attributes.textureSet, 16u ) << 32u ) |
+                           ( FoldPointer( attributes.geometry, 12u ) << depthBits ) |
+                           depth;
+    }
+  }
+}
+
 void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
                                           SortedLayerPointers& sortedLayers,
                                           RenderTask& renderTask,
@@ -431,7 +566,7 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
     {
       RenderableContainer& renderables = layer.colorRenderables;
 
-      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
+      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, mPartialUpdateAvailable, &renderList ) )
       {
         renderList->SetHasColorRenderItems( true );
         AddRenderersToRenderList( updateBufferIndex,
@@ -453,7 +588,7 @@ void RenderInstructionProcessor::Prepare( BufferIndex updateBufferIndex,
     {
       RenderableContainer& renderables = layer.overlayRenderables;
 
-      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, &renderList ) )
+      if( !SetupRenderList( renderables, layer, instruction, tryReuseRenderList, mPartialUpdateAvailable, &renderList ) )
       {
         renderList->SetHasColorRenderItems( false );
         AddRenderersToRenderList( updateBufferIndex,
@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/integration-api/core-enumerations.h>
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/sorted-layers.h>
 #include <dali/public-api/common/dali-vector.h>
@@ -54,8 +55,9 @@ public:
 
   /**
    * @brief Constructor.
+   * @param[in] partialUpdateAvailable Whether the surfaces can be partially updated
    */
-  RenderInstructionProcessor();
+  RenderInstructionProcessor( Integration::PartialUpdateAvailable partialUpdateAvailable );
 
   /**
    * @brief Destructor.
@@ -73,6 +75,7 @@ public:
       shader( NULL ),
       textureSet( NULL ),
       geometry( NULL ),
+      sortKey( 0u ),
       zValue( 0.0f )
     {
     }
@@ -81,6 +84,7 @@ public:
     const Shader*           shader;            ///< The shader instance
     const void*             textureSet;        ///< The textureSet instance
     const Render::Geometry* geometry;          ///< The geometry instance
+    uint64_t                sortKey;           ///< Packed render state and depth of an opaque item, only used when the layer sorts by render state
     float                   zValue;            ///< The Z value of the given renderer (either distance from camera, or a custom calculated value)
   };
 
@@ -128,12 +132,21 @@ private:
    */
   inline void SortRenderItems( BufferIndex bufferIndex, RenderList& renderList, Layer& layer, bool respectClippingOrder );
 
+  /**
+   * @brief Calculate the sort keys of the opaque items in the sorting helper.
+   * The key packs the shader, texture set and geometry, so items sharing render state are drawn consecutively,
+   * followed by the Z value, so items with the same state are drawn front to back.
+   * @param count The number of items in the sorting helper
+   */
+  inline void CalculateRenderStateSortKeys( uint32_t count );
+
   /// Sort comparitor function pointer type.
   typedef bool ( *ComparitorPointer )( const SortAttributes& lhs, const SortAttributes& rhs );
   typedef std::vector< SortAttributes > SortingHelper;
 
   Dali::Vector< ComparitorPointer > mSortComparitors;       ///< Contains all sort comparitors, used for quick look-up
   RenderInstructionProcessor::SortingHelper mSortingHelper; ///< Helper used to sort Renderers
+  bool mPartialUpdateAvailable;                             ///< Whether the cached render items must be rebuilt to mark the updated ones
 
 };
 
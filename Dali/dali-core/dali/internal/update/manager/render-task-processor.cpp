@@ -309,7 +309,8 @@ bool ProcessTasks( BufferIndex updateBufferIndex,
 
 } // Anonymous namespace.
 
-RenderTaskProcessor::RenderTaskProcessor()
+RenderTaskProcessor::RenderTaskProcessor( Integration::PartialUpdateAvailable partialUpdateAvailable )
+: mRenderInstructionProcessor( partialUpdateAvailable )
 {
 }
 
@@ -42,8 +42,9 @@ public:
 
   /**
    * @brief Constructor.
+   * @param[in] partialUpdateAvailable Whether the surfaces can be partially updated
    */
-  RenderTaskProcessor();
+  RenderTaskProcessor( Integration::PartialUpdateAvailable partialUpdateAvailable );
 
   /**
    * @brief Destructor.
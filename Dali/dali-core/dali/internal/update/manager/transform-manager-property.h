@@ -127,6 +127,15 @@ struct TransformManagerPropertyHandler : public AnimatablePropertyBase
    */
   virtual bool IsClean() const{ return false; }
 
+  /**
+   * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
+   * @note This is only accurate once the TransformManager has been updated in the current frame.
+   */
+  virtual bool InputChanged() const
+  {
+    return !mTxManager || mTxManager->IsLocalMatrixDirty( mId );
+  }
+
   /**
    * Initializes the property
    * @param[in] transformManager Pointer to the transform manager
@@ -342,10 +351,11 @@ public:
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
    * @note A constraint can only receive the inherited property from the previous frame.
+   * This is only accurate once the TransformManager has been updated in the current frame.
    */
   virtual bool InputChanged() const
   {
-    return true;
+    return !mTxManager || mTxManager->IsLocalMatrixDirty( mId );
   }
 
   /**
@@ -504,10 +514,11 @@ public:
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
    * @note A constraint can only receive the inherited property from the previous frame.
+   * This is only accurate once the TransformManager has been updated in the current frame.
    */
   virtual bool InputChanged() const
   {
-    return true;
+    return !mTxManager || mTxManager->IsLocalMatrixDirty( mId );
   }
 
   /**
@@ -655,10 +666,11 @@ public:
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
    * @note A constraint can only receive the inherited property from the previous frame.
+   * This is only accurate once the TransformManager has been updated in the current frame.
    */
   virtual bool InputChanged() const
   {
-    return true;
+    return !mTxManager || mTxManager->IsLocalMatrixDirty( mId );
   }
 
   /**
@@ -20,11 +20,14 @@
 
 //EXTERNAL INCLUDES
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 //INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
+#include <dali/devel-api/threading/thread-pool.h>
 #include <dali/internal/common/math.h>
 
 namespace Dali
@@ -47,6 +50,55 @@ static const float gDefaultTransformComponentStaticData[] = { 0.5f, 0.5f, 0.5f,
 static_assert( sizeof(gDefaultTransformComponentAnimatableData) == sizeof(TransformComponentAnimatable), "gDefaultTransformComponentAnimatableData should have the same number of floats as specified in TransformComponentAnimatable" );
 static_assert( sizeof(gDefaultTransformComponentStaticData) == sizeof(TransformComponentStatic), "gDefaultTransformComponentStaticData should have the same number of floats as specified in TransformComponentStatic" );
 
+const Vector3 HALF( 0.5f, 0.5f, 0.5f );
+const Vector3 TOP_LEFT( 0.0f, 0.0f, 0.5f );
+
+// Below this, a level of the hierarchy is not worth splitting between threads
+const uint32_t MINIMUM_COMPONENTS_PER_TASK = 128u;
+
+/**
+ * @brief Grows a bounding sphere so that it also contains another one
+ * @param[in,out] sphere The sphere to grow. XYZ is the center and W is the radius
+ * @param[in] other The sphere to contain
+ */
+inline void MergeBoundingSphere( Vector4& sphere, const Vector4& other )
+{
+  if( std::isinf( sphere.w ) )
+  {
+    // Already unbounded
+    return;
+  }
+
+  if( std::isinf( other.w ) )
+  {
+    sphere.w = other.w;
+    return;
+  }
+
+  const Vector3 offset( other.x - sphere.x, other.y - sphere.y, other.z - sphere.z );
+  const float distance = offset.Length();
+  if( distance + other.w <= sphere.w )
+  {
+    // The other sphere is inside
+    return;
+  }
+
+  if( distance + sphere.w <= other.w )
+  {
+    // The other sphere contains this one
+    sphere = other;
+    return;
+  }
+
+  // Otherwise the distance is positive, so the center moves towards the other sphere
+  const float radius = ( distance + sphere.w + other.w ) * 0.5f;
+  const float move = ( radius - sphere.w ) / distance;
+  sphere.x += offset.x * move;
+  sphere.y += offset.y * move;
+  sphere.z += offset.z * move;
+  sphere.w = radius;
+}
+
 /**
  * @brief Calculates the center position for the transform component
  * @param[out] centerPosition The calculated center-position of the transform component
@@ -79,8 +131,17 @@ inline void CalculateCenterPosition(
 
 TransformManager::TransformManager()
 :mComponentCount(0),
- mReorder(false)
-{}
+ mThreadPool( nullptr ),
+ mParallelThreadCount(0u),
+ mParallelUpdateThreshold(0u),
+ mUpdatedComponentCount(0u),
+ mReorder(false),
+ mSubtreeBoundsDirty(2u),
+ mSubtreeBoundsEnabled(false)
+{
+  mSubtreeBoundsValid[0] = false;
+  mSubtreeBoundsValid[1] = false;
+}
 
 TransformManager::~TransformManager()
 {}
@@ -104,7 +165,7 @@ TransformId TransformManager::CreateTransform()
     mBoundingSpheres.PushBack( Vector4(0.0f,0.0f,0.0f,0.0f) );
     mTxComponentAnimatableBaseValue.PushBack(TransformComponentAnimatable());
     mSizeBase.PushBack(Vector3(0.0f,0.0f,0.0f));
-    mComponentDirty.PushBack(false);
+    mComponentDirty.PushBack(true);
     mLocalMatrixDirty.PushBack(false);
   }
   else
@@ -121,11 +182,12 @@ TransformId TransformManager::CreateTransform()
     mWorld[mComponentCount].SetIdentity();
     mBoundingSpheres[mComponentCount] = Vector4(0.0f,0.0f,0.0f,0.0f);
     mSizeBase[mComponentCount] = Vector3(0.0f,0.0f,0.0f);
-    mComponentDirty[mComponentCount] = false;
+    mComponentDirty[mComponentCount] = true;
     mLocalMatrixDirty[mComponentCount] = false;
   }
 
   mComponentCount++;
+  mSubtreeBoundsDirty = 2u;
   return id;
 }
 
@@ -153,6 +215,7 @@ void TransformManager::RemoveTransform(TransformId id)
   mIds.Remove( id );
 
   mReorder = true;
+  mSubtreeBoundsDirty = 2u;
 }
 
 void TransformManager::SetParent( TransformId id, TransformId parentId )
@@ -162,6 +225,7 @@ void TransformManager::SetParent( TransformId id, TransformId parentId )
   mParent[ index ] = parentId;
   mComponentDirty[ index ] = true;
   mReorder = true;
+  mSubtreeBoundsDirty = 2u;
 }
 
 const Matrix& TransformManager::GetWorldMatrix( TransformId id ) const
@@ -223,6 +287,16 @@ void TransformManager::ResetToBaseValue()
 {
   if( mComponentCount )
   {
+    //Components whose animated values are reverted have to be updated, as nothing else marks them as dirty
+    for( uint32_t i(0); i<mComponentCount; ++i )
+    {
+      if( memcmp( &mTxComponentAnimatable[i], &mTxComponentAnimatableBaseValue[i], sizeof(TransformComponentAnimatable) ) != 0 ||
+          memcmp( &mSize[i], &mSizeBase[i], sizeof(Vector3) ) != 0 )
+      {
+        mComponentDirty[i] = true;
+      }
+    }
+
     memcpy( &mTxComponentAnimatable[0], &mTxComponentAnimatableBaseValue[0], sizeof(TransformComponentAnimatable)*mComponentCount );
     memcpy( &mSize[0], &mSizeBase[0], sizeof(Vector3)*mComponentCount );
     memset( &mLocalMatrixDirty[0], false, sizeof(bool)*mComponentCount );
@@ -239,91 +313,258 @@ void TransformManager::Update()
     mReorder = false;
   }
 
-  //Iterate through all components to compute its world matrix
+  uint32_t updatedCount = 0u;
+  if( mThreadPool && ( mComponentCount >= mParallelUpdateThreshold ) )
+  {
+    //Components are ordered by level, so each level only depends on the levels before
+    const uint32_t boundaryCount = static_cast<uint32_t>( mLevelBoundaries.Count() );
+    for( uint32_t level = 1u; level < boundaryCount; ++level )
+    {
+      updatedCount += UpdateComponentsInParallel( mLevelBoundaries[level - 1u], mLevelBoundaries[level] );
+    }
+
+    //Components created since the last reorder have no parent nor children
+    const uint32_t reorderedCount = boundaryCount > 0u ? mLevelBoundaries[boundaryCount - 1u] : 0u;
+    updatedCount += UpdateComponentsInParallel( std::min( reorderedCount, mComponentCount ), mComponentCount );
+  }
+  else
+  {
+    //Iterate through all components to compute the world matrix of the ones which have changed
+    for( uint32_t i(0); i<mComponentCount; ++i )
+    {
+      updatedCount += UpdateComponent( i ) ? 1u : 0u;
+    }
+  }
+
+  mUpdatedComponentCount = updatedCount;
+
+  if( updatedCount > 0u )
+  {
+    mSubtreeBoundsDirty = 2u;
+  }
+}
+
+void TransformManager::SetSubtreeBoundsEnabled( bool enabled )
+{
+  mSubtreeBoundsEnabled = enabled;
+  mSubtreeBoundsDirty = 2u;
+}
+
+bool TransformManager::GetSubtreeBoundingSphere( BufferIndex bufferIndex, TransformId id, Vector4& sphere ) const
+{
+  const Vector< Vector4 >& spheres = mSubtreeBoundingSpheres[bufferIndex];
+  if( !mSubtreeBoundsValid[bufferIndex] || id >= spheres.Count() )
+  {
+    return false;
+  }
+
+  sphere = spheres[id];
+  return true;
+}
+
+void TransformManager::UpdateSubtreeBoundingSpheres( BufferIndex bufferIndex )
+{
+  if( !mSubtreeBoundsEnabled )
+  {
+    mSubtreeBoundsValid[bufferIndex] = false;
+    return;
+  }
+
+  if( mSubtreeBoundsValid[bufferIndex] && mSubtreeBoundsDirty == 0u )
+  {
+    return;
+  }
+
+  //The event thread reads the other buffer, so this one can be rebuilt in place. The spheres are indexed by Id,
+  //which is less than the number of components allocated
+  Vector< Vector4 >& spheres = mSubtreeBoundingSpheres[bufferIndex];
+  spheres.Resize( mTxComponentAnimatable.Size() );
+
+  //The sphere of each component is the one of the ray-sphere test of hit testing; centered on the world position,
+  //with a radius computed from the size scaled by the lengths of the axes of the world matrix
+  for( uint32_t i(0); i<mComponentCount; ++i )
+  {
+    const float* world = mWorld[i].AsFloat();
+    const float scaleX2 = world[0] * world[0] + world[1] * world[1] + world[2] * world[2];
+    const float scaleY2 = world[4] * world[4] + world[5] * world[5] + world[6] * world[6];
+    const float radius = sqrtf( 0.5f * ( mSize[i].x * mSize[i].x * scaleX2 + mSize[i].y * mSize[i].y * scaleY2 ) );
+
+    Vector4& sphere = spheres[ mComponentId[i] ];
+    sphere = Vector4( world[12], world[13], world[14], radius );
+    if( !std::isfinite( sphere.x + sphere.y + sphere.z + sphere.w ) )
+    {
+      sphere.w = std::numeric_limits<float>::infinity();
+    }
+  }
+
+  //Children come after their parents, so iterating backwards merges the sub-tree of each component before its parent's
+  for( uint32_t i(mComponentCount); i>0u; --i )
+  {
+    const TransformId parentId = mParent[i-1u];
+    if( parentId != INVALID_TRANSFORM_ID )
+    {
+      MergeBoundingSphere( spheres[ parentId ], spheres[ mComponentId[i-1u] ] );
+    }
+  }
+
+  mSubtreeBoundsValid[bufferIndex] = true;
+  if( mSubtreeBoundsDirty > 0u )
+  {
+    --mSubtreeBoundsDirty;
+  }
+}
+
+void TransformManager::SetParallelUpdate( Dali::ThreadPool* threadPool, uint32_t threadCount, uint32_t componentThreshold )
+{
+  mThreadPool = ( threadCount > 0u ) ? threadPool : nullptr;
+  mParallelThreadCount = threadCount;
+  mParallelUpdateThreshold = componentThreshold;
+}
+
+uint32_t TransformManager::UpdateComponentsInParallel( uint32_t begin, uint32_t end )
+{
+  const uint32_t count = end > begin ? end - begin : 0u;
+  const uint32_t taskCount = std::min( std::min( static_cast<uint32_t>( mThreadPool->GetWorkerCount() ), mParallelThreadCount ) + 1u, count / MINIMUM_COMPONENTS_PER_TASK );
+  uint32_t updatedCount = 0u;
+  if( taskCount < 2u )
+  {
+    for( uint32_t i = begin; i < end; ++i )
+    {
+      updatedCount += UpdateComponent( i ) ? 1u : 0u;
+    }
+    return updatedCount;
+  }
+
+  //The last part is updated in this thread while the workers update the others
+  const uint32_t componentsPerTask = ( count + taskCount - 1u ) / taskCount;
+  //Each task counts its updated components in its own slot
+  std::vector< uint32_t > taskUpdatedCounts( taskCount - 1u, 0u );
+  std::vector< Dali::Task > tasks;
+  tasks.reserve( taskCount - 1u );
+  for( uint32_t task = 0u; task < taskCount - 1u; ++task )
+  {
+    const uint32_t taskBegin = begin + task * componentsPerTask;
+    const uint32_t taskEnd = taskBegin + componentsPerTask;
+    uint32_t* taskUpdatedCount = &taskUpdatedCounts[task];
+    tasks.push_back( [this, taskBegin, taskEnd, taskUpdatedCount]( uint32_t )
+    {
+      uint32_t updated = 0u;
+      for( uint32_t i = taskBegin; i < taskEnd; ++i )
+      {
+        updated += UpdateComponent( i ) ? 1u : 0u;
+      }
+      *taskUpdatedCount = updated;
+    } );
+  }
+
+  Dali::UniqueFutureGroup futures = mThreadPool->SubmitTasks( tasks, taskCount - 1u );
+
+  for( uint32_t i = begin + ( taskCount - 1u ) * componentsPerTask; i < end; ++i )
+  {
+    updatedCount += UpdateComponent( i ) ? 1u : 0u;
+  }
+
+  futures->Wait();
+
+  for( auto&& taskUpdatedCount : taskUpdatedCounts )
+  {
+    updatedCount += taskUpdatedCount;
+  }
+  return updatedCount;
+}
+
+bool TransformManager::UpdateComponent( uint32_t i )
+{
   Vector3 centerPosition;
   Vector3 localPosition;
-  const Vector3 half( 0.5f,0.5f,0.5f );
-  const Vector3 topLeft( 0.0f, 0.0f, 0.5f );
-  for( unsigned int i(0); i<mComponentCount; ++i )
+  if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
   {
-    if( DALI_LIKELY( mInheritanceMode[i] != DONT_INHERIT_TRANSFORM && mParent[i] != INVALID_TRANSFORM_ID ) )
+    const TransformId& parentIndex = mIds[mParent[i] ];
+
+    //The local matrix of the parent is dirty whenever its world matrix has been recomputed
+    if( !mComponentDirty[i] && !mLocalMatrixDirty[parentIndex] )
+    {
+      //Neither the component nor any of its ancestors have changed
+      return false;
+    }
+
+    if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
+    {
+      //Full transform inherited
+      mLocalMatrixDirty[i] = true;
+      CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+      localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - HALF ) *  mSize[parentIndex];
+      mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
+
+      //Update the world matrix
+      Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+    }
+    else
     {
-      const TransformId& parentIndex = mIds[mParent[i] ];
-      if( DALI_LIKELY( mInheritanceMode[i] == INHERIT_ALL ) )
+      //Some components are not inherited
+      Vector3 parentPosition, parentScale;
+      Quaternion parentOrientation;
+      const Matrix& parentMatrix = mWorld[parentIndex];
+      parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
+
+      Vector3 localScale = mTxComponentAnimatable[i].mScale;
+      if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
+      {
+        //Don't inherit scale
+        localScale /= parentScale;
+      }
+
+      Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
+      if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
+      {
+        //Don't inherit orientation
+        parentOrientation.Invert();
+        localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
+      }
+
+      if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
       {
-        if( mComponentDirty[i] || mLocalMatrixDirty[parentIndex])
-        {
-          //Full transform inherited
-          mLocalMatrixDirty[i] = true;
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
-        }
-
-        //Update the world matrix
-        Matrix::Multiply( mWorld[i], mLocal[i], mWorld[parentIndex]);
+        //Don't inherit position
+        CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+        mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
+        Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
+        mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition + centerPosition );
       }
       else
       {
-        //Some components are not inherited
-        Vector3 parentPosition, parentScale;
-        Quaternion parentOrientation;
-        const Matrix& parentMatrix = mWorld[parentIndex];
-        parentMatrix.GetTransformComponents( parentPosition, parentOrientation, parentScale );
-
-        Vector3 localScale = mTxComponentAnimatable[i].mScale;
-        if( (mInheritanceMode[i] & INHERIT_SCALE) == 0 )
-        {
-          //Don't inherit scale
-          localScale /= parentScale;
-        }
-
-        Quaternion localOrientation( mTxComponentAnimatable[i].mOrientation );
-        if( (mInheritanceMode[i] & INHERIT_ORIENTATION) == 0 )
-        {
-          //Don't inherit orientation
-          parentOrientation.Invert();
-          localOrientation = parentOrientation * mTxComponentAnimatable[i].mOrientation;
-        }
-
-        if( (mInheritanceMode[i] & INHERIT_POSITION) == 0 )
-        {
-          //Don't inherit position
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          mLocal[i].SetTransformComponents( localScale, localOrientation, Vector3::ZERO );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
-          mWorld[i].SetTranslation( mTxComponentAnimatable[i].mPosition + centerPosition );
-        }
-        else
-        {
-          CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-          localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - half ) *  mSize[parentIndex];
-          mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
-          Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
-        }
-
-        mLocalMatrixDirty[i] = true;
+        CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+        localPosition = mTxComponentAnimatable[i].mPosition + centerPosition + ( mTxComponentStatic[i].mParentOrigin - HALF ) *  mSize[parentIndex];
+        mLocal[i].SetTransformComponents( localScale, localOrientation, localPosition );
+        Matrix::Multiply( mWorld[i], mLocal[i], parentMatrix );
       }
+
+      mLocalMatrixDirty[i] = true;
     }
-    else  //Component has no parent or doesn't inherit transform
+  }
+  else  //Component has no parent or doesn't inherit transform
+  {
+    if( !mComponentDirty[i] )
     {
-      CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], half, topLeft );
-      localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
-      mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
-      mWorld[i] = mLocal[i];
-      mLocalMatrixDirty[i] = true;
+      return false;
     }
 
-    //Update the bounding sphere
-    Vec3 centerToEdge = { mSize[i].Length() * 0.5f, 0.0f, 0.0f };
-    Vec3 centerToEdgeWorldSpace;
-    TransformVector3( centerToEdgeWorldSpace, mWorld[i].AsFloat(), centerToEdge );
+    CalculateCenterPosition( centerPosition, mTxComponentStatic[ i ], mTxComponentAnimatable[ i ], mSize[ i ], HALF, TOP_LEFT );
+    localPosition = mTxComponentAnimatable[i].mPosition + centerPosition;
+    mLocal[i].SetTransformComponents( mTxComponentAnimatable[i].mScale, mTxComponentAnimatable[i].mOrientation, localPosition );
+    mWorld[i] = mLocal[i];
+    mLocalMatrixDirty[i] = true;
+  }
+
+  //Update the bounding sphere
+  Vec3 centerToEdge = { mSize[i].Length() * 0.5f, 0.0f, 0.0f };
+  Vec3 centerToEdgeWorldSpace;
+  TransformVector3( centerToEdgeWorldSpace, mWorld[i].AsFloat(), centerToEdge );
 
-    mBoundingSpheres[i] = mWorld[i].GetTranslation();
-    mBoundingSpheres[i].w = Length( centerToEdgeWorldSpace );
+  mBoundingSpheres[i] = mWorld[i].GetTranslation();
+  mBoundingSpheres[i].w = Length( centerToEdgeWorldSpace );
 
-    mComponentDirty[i] = false;
-  }
+  mComponentDirty[i] = false;
+  return true;
 }
 
 void TransformManager::SwapComponents( unsigned int i, unsigned int j )
@@ -338,6 +579,7 @@ void TransformManager::SwapComponents( unsigned int i, unsigned int j )
   std::swap( mSizeBase[i], mSizeBase[j] );
   std::swap( mLocal[i], mLocal[j] );
   std::swap( mComponentDirty[i], mComponentDirty[j] );
+  std::swap( mLocalMatrixDirty[i], mLocalMatrixDirty[j] );
   std::swap( mBoundingSpheres[i], mBoundingSpheres[j] );
   std::swap( mWorld[i], mWorld[j] );
 
@@ -364,6 +606,17 @@ void TransformManager::ReorderComponents()
   }
 
   std::stable_sort( mOrderedComponents.Begin(), mOrderedComponents.End());
+
+  //Record where each level starts, so the levels can be updated in parallel
+  mLevelBoundaries.Clear();
+  for( TransformId i = 0; i<mComponentCount; ++i )
+  {
+    if( i == 0 || mOrderedComponents[i].level != mOrderedComponents[i-1].level )
+    {
+      mLevelBoundaries.PushBack( i );
+    }
+  }
+  mLevelBoundaries.PushBack( mComponentCount );
   TransformId previousIndex = 0;
   for( TransformId newIndex = 0; newIndex < mComponentCount-1; ++newIndex )
   {
@@ -24,11 +24,14 @@
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/vector3.h>
 #include <dali/public-api/common/constants.h>
+#include <dali/internal/common/buffer-index.h>
 #include <dali/internal/update/manager/free-list.h>
 
 namespace Dali
 {
 
+class ThreadPool;
+
 namespace Internal
 {
 
@@ -161,6 +164,7 @@ public:
 
   /**
    * Checks if the local transform was updated in the last Update
+   * @note The local matrix is recomputed whenever the world matrix is, so this is also true if an ancestor has changed.
    * @param[in] id Id of the transform
    * @return true if local matrix changed in the last update, false otherwise
    */
@@ -191,10 +195,51 @@ public:
   void SetInheritOrientation( TransformId id, bool inherit );
 
   /**
-   * Recomputes all world transform matrices
+   * Recomputes the world transform matrices of the components which have changed, or whose ancestors have changed, since the last Update
    */
   void Update();
 
+  /**
+   * Gets the number of world transform matrices recomputed in the last Update
+   * @return The number of components updated
+   */
+  uint32_t GetUpdatedComponentCount() const
+  {
+    return mUpdatedComponentCount;
+  }
+
+  /**
+   * Sets whether the components of each level of the hierarchy are updated in parallel.
+   * The components of a level only depend on their parents, so each level is split between the worker threads.
+   * @param[in] threadPool The worker threads, owned by the caller, or null to always update serially
+   * @param[in] threadCount The number of worker threads to use from the pool
+   * @param[in] componentThreshold The minimum number of components to update in parallel; smaller scenes are updated serially
+   */
+  void SetParallelUpdate( Dali::ThreadPool* threadPool, uint32_t threadCount, uint32_t componentThreshold );
+
+  /**
+   * Sets whether a bounding sphere of each component and all its descendants is computed after each Update.
+   * The sphere contains the spheres used by the ray-sphere test of hit testing, so a sub-tree that the ray misses can be skipped.
+   * @param[in] enabled True to compute the sub-tree bounding spheres
+   */
+  void SetSubtreeBoundsEnabled( bool enabled );
+
+  /**
+   * Computes the sub-tree bounding spheres from the world matrices and sizes of the components, if enabled.
+   * The spheres are double buffered, as they are read by the event thread; this must be called after Update.
+   * @param[in] bufferIndex The current update buffer index
+   */
+  void UpdateSubtreeBoundingSpheres( BufferIndex bufferIndex );
+
+  /**
+   * Get the bounding sphere, in world coordinates, of a given component and all its descendants
+   * @param[in] bufferIndex The buffer to read from
+   * @param[in] id Id of the transform component
+   * @param[out] sphere The bounding sphere. XYZ is the center and W is the radius, which is infinite if the sub-tree is unbounded
+   * @return false if the sub-tree bounding spheres are disabled or not computed for the component
+   */
+  bool GetSubtreeBoundingSphere( BufferIndex bufferIndex, TransformId id, Vector4& sphere ) const;
+
   /**
    * Resets all the animatable properties to its base value
    */
@@ -374,6 +419,22 @@ private:
    */
   void ReorderComponents();
 
+  /**
+   * Computes the local and world matrices and the bounding sphere of a component, if it or its parent has changed.
+   * The parent of the component must have been updated already.
+   * @param[in] index Index of the component
+   * @return true if the world matrix was recomputed, false if the component was skipped
+   */
+  bool UpdateComponent( uint32_t index );
+
+  /**
+   * Updates a range of components which do not depend on each other, splitting it between the worker threads if it is large enough
+   * @param[in] begin Index of the first component
+   * @param[in] end Index after the last component
+   * @return The number of components whose world matrix was recomputed
+   */
+  uint32_t UpdateComponentsInParallel( uint32_t begin, uint32_t end );
+
   uint32_t mComponentCount;                                               ///< Total number of components
   FreeList mIds;                                                          ///< FreeList of Ids
   Vector< TransformComponentAnimatable > mTxComponentAnimatable;          ///< Animatable part of the components
@@ -390,7 +451,16 @@ private:
   Vector< bool > mComponentDirty;                                         ///< 1u if some of the parts of the component has changed in this frame, 0 otherwise
   Vector< bool > mLocalMatrixDirty;                                       ///< 1u if the local matrix has been updated in this frame, 0 otherwise
   Vector< SOrderItem > mOrderedComponents;                                ///< Used to reorder components when hierarchy changes
+  Vector< Vector4 > mSubtreeBoundingSpheres[2];                           ///< Bounding spheres of the components and their descendants by Id, for hit testing; double buffered
+  Vector< uint32_t > mLevelBoundaries;                                    ///< Index of the first component of each level after the last reorder, followed by the number of components reordered
+  Dali::ThreadPool* mThreadPool;                                          ///< Worker threads for parallel update, not owned; null if disabled
+  uint32_t mParallelThreadCount;                                          ///< Number of worker threads used for parallel update
+  uint32_t mParallelUpdateThreshold;                                      ///< Minimum number of components to update in parallel
+  uint32_t mUpdatedComponentCount;                                        ///< Number of world matrices recomputed in the last Update
   bool mReorder;                                                          ///< Flag to determine if the components have to reordered in the next Update
+  uint32_t mSubtreeBoundsDirty;                                           ///< Number of buffers whose sub-tree bounding spheres are out of date
+  bool mSubtreeBoundsEnabled;                                             ///< Whether the sub-tree bounding spheres are computed
+  bool mSubtreeBoundsValid[2];                                            ///< Whether the sub-tree bounding spheres of each buffer have been computed
 };
 
 } //namespace SceneGraph
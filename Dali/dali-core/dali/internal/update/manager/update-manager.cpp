@@ -22,6 +22,7 @@
 #include <dali/public-api/common/stage.h>
 #include <dali/devel-api/common/owner-container.h>
 #include <dali/devel-api/threading/mutex.h>
+#include <dali/devel-api/threading/thread-pool.h>
 
 #include <dali/integration-api/core.h>
 #include <dali/integration-api/render-controller.h>
@@ -40,6 +41,7 @@
 #include <dali/internal/update/animation/scene-graph-animator.h>
 #include <dali/internal/update/animation/scene-graph-animation.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/common/scene-graph-property-notification-index.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
 #include <dali/internal/update/controllers/render-message-dispatcher.h>
 #include <dali/internal/update/controllers/scene-controller-impl.h>
@@ -108,6 +110,57 @@ namespace SceneGraph
 
 namespace
 {
+
+const uint32_t MINIMUM_ANIMATORS_PER_TASK = 64u; // Smaller tasks cost more to schedule than to update
+
+/**
+ * Helper to choose the task which updates the animators of a property owner.
+ * @param[in] propertyOwner The property owner
+ * @param[in] taskCount The number of tasks
+ * @return The index of the task
+ */
+inline uint32_t GetAnimatorTask( const PropertyOwner* propertyOwner, uint32_t taskCount )
+{
+  // Heap objects are at least 8 byte aligned, even on 32-bit targets; mix the remaining bits so neighbouring objects go to different tasks
+  const uint32_t hash = static_cast<uint32_t>( reinterpret_cast<std::uintptr_t>( propertyOwner ) >> 3u ) * 2654435761u;
+  return ( hash >> 16u ) % taskCount;
+}
+
+/**
+ * Helper to add an object to a container, storing its position in the object
+ * @param container to add to
+ * @param object to add
+ */
+template < class T >
+inline void AddUsingContainerIndex( Vector<T*>& container, T* object )
+{
+  object->SetContainerIndex( static_cast<uint32_t>( container.Count() ) );
+  container.PushBack( object );
+}
+
+/**
+ * Helper to remove an object from a container in constant time, by moving the last object to its position.
+ * The object is not deleted, even if the container is an OwnerContainer.
+ * @param container to remove from
+ * @param object to remove
+ */
+template < class T >
+inline void RemoveUsingContainerIndex( Vector<T*>& container, T* object )
+{
+  DALI_ASSERT_DEBUG( object && "NULL object not allowed" );
+
+  const uint32_t index = object->GetContainerIndex();
+  DALI_ASSERT_DEBUG( index < container.Count() && container[index] == object && "Object not in container" );
+
+  T* lastObject = container[ container.Count() - 1u ];
+  container[ index ] = lastObject;
+  lastObject->SetContainerIndex( index );
+
+  // Vector::Resize does not delete the removed object, unlike OwnerContainer::Resize
+  container.Resize( container.Count() - 1u );
+  object->SetContainerIndex( ContainerIndex::INVALID_CONTAINER_INDEX );
+}
+
 /**
  * Helper to Erase an object from OwnerContainer using discard queue
  * @param container to remove from
@@ -118,18 +171,10 @@ namespace
 template < class T >
 inline void EraseUsingDiscardQueue( OwnerContainer<T*>& container, T* object, DiscardQueue& discardQueue, BufferIndex updateBufferIndex )
 {
-  DALI_ASSERT_DEBUG( object && "NULL object not allowed" );
+  RemoveUsingContainerIndex( container, object );
 
-  // need to use the reference version of auto as we need the pointer to the pointer for the Release call below
-  for( auto&& iter : container )
-  {
-    if ( iter == object )
-    {
-      // Transfer ownership to the discard queue, this keeps the object alive, until the render-thread has finished with it
-      discardQueue.Add( updateBufferIndex, container.Release( &iter ) ); // take the address of the reference to a pointer (iter)
-      return; // return as we only ever remove one object. Iterators to container are now invalidated as well so cannot continue
-    }
-  }
+  // Transfer ownership to the discard queue, this keeps the object alive, until the render-thread has finished with it
+  discardQueue.Add( updateBufferIndex, object );
 }
 
 /**
@@ -204,6 +249,13 @@ struct UpdateManager::Impl
     panGestureProcessor( NULL ),
     messageQueue( renderController, sceneGraphBuffers ),
     frameCallbackProcessor( NULL ),
+    animatorUpdates(),
+    animatorTasks(),
+    threadPool(),
+    transformThreadCount( 0u ),
+    transformComponentThreshold( 0u ),
+    animationThreadCount( 0u ),
+    parallelAnimationThreshold( 0u ),
     keepRenderingSeconds( 0.0f ),
     nodeDirtyFlags( NodePropertyFlags::TRANSFORM ), // set to TransformFlag to ensure full update the first time through Update()
     frameCounter( 0 ),
@@ -215,9 +267,6 @@ struct UpdateManager::Impl
     surfaceRectChanged( false )
   {
     sceneController = new SceneControllerImpl( renderMessageDispatcher, renderQueue, discardQueue );
-
-    // create first 'dummy' node
-    nodes.PushBack(0u);
   }
 
   ~Impl()
@@ -237,7 +286,7 @@ struct UpdateManager::Impl
 
     // UpdateManager owns the Nodes. Although Nodes are pool allocated they contain heap allocated parts
     // like custom properties, which get released here
-    Vector<Node*>::Iterator iter = nodes.Begin()+1;
+    Vector<Node*>::Iterator iter = nodes.Begin();
     Vector<Node*>::Iterator endIter = nodes.End();
     for(;iter!=endIter;++iter)
     {
@@ -299,6 +348,8 @@ struct UpdateManager::Impl
   OwnerContainer< PropertyResetterBase* > propertyResetters;          ///< A container of property resetters
   OwnerContainer< Animation* >         animations;                    ///< A container of owned animations
   PropertyNotificationContainer        propertyNotifications;         ///< A container of owner property notifications.
+  PropertyNotificationIndex            propertyNotificationIndex;     ///< Selects the property notifications to check in each frame
+  Vector< PropertyNotification* >      notifiedPropertyNotifications; ///< The property notifications to send in the current frame
   OwnerContainer< Renderer* >          renderers;                     ///< A container of owned renderers
   OwnerContainer< TextureSet* >        textureSets;                   ///< A container of owned texture sets
   OwnerContainer< Shader* >            shaders;                       ///< A container of owned shaders
@@ -311,6 +362,14 @@ struct UpdateManager::Impl
 
   OwnerPointer<FrameCallbackProcessor> frameCallbackProcessor;        ///< Owned FrameCallbackProcessor, only created if required.
 
+  AnimatorUpdateContainer              animatorUpdates;               ///< The animator updates of this frame, when parallel animation is enabled
+  std::vector< Vector< uint32_t > >    animatorTasks;                 ///< The indices of the animator updates applied by each task
+  std::unique_ptr< Dali::ThreadPool >  threadPool;                    ///< Worker threads shared by the parallel transform update and animation, null if both are disabled
+  uint32_t                             transformThreadCount;          ///< Number of worker threads for the parallel transform update, 0 if disabled
+  uint32_t                             transformComponentThreshold;   ///< Minimum number of components to update in parallel
+  uint32_t                             animationThreadCount;          ///< Number of worker threads for parallel animation, 0 if disabled
+  uint32_t                             parallelAnimationThreshold;    ///< Minimum number of animator updates to apply in parallel
+
   float                                keepRenderingSeconds;          ///< Set via Dali::Stage::KeepRendering
   NodePropertyFlags                    nodeDirtyFlags;                ///< cumulative node dirty flags from previous frame
   uint32_t                             frameCounter;                  ///< Frame counter used in debugging to choose which frame to debug and which to ignore.
@@ -400,20 +459,11 @@ void UpdateManager::AddNode( OwnerPointer<Node>& node )
 {
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
-  // Nodes must be sorted by pointer
   Node* rawNode = node.Release();
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] AddNode\n", rawNode );
 
-  Vector<Node*>::Iterator begin = mImpl->nodes.Begin();
-  for( Vector<Node*>::Iterator iter = mImpl->nodes.End()-1; iter >= begin; --iter )
-  {
-    if( rawNode > (*iter) )
-    {
-      mImpl->nodes.Insert((iter+1), rawNode );
-      rawNode->CreateTransform( &mImpl->transformManager );
-      return;
-    }
-  }
+  AddUsingContainerIndex( mImpl->nodes, rawNode );
+  rawNode->CreateTransform( &mImpl->transformManager );
 }
 
 void UpdateManager::ConnectNode( Node* parent, Node* node )
@@ -457,16 +507,7 @@ void UpdateManager::DestroyNode( Node* node )
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] DestroyNode\n", node );
 
-  Vector<Node*>::Iterator iter = mImpl->nodes.Begin()+1;
-  Vector<Node*>::Iterator endIter = mImpl->nodes.End();
-  for(;iter!=endIter;++iter)
-  {
-    if((*iter) == node)
-    {
-      mImpl->nodes.Erase(iter);
-      break;
-    }
-  }
+  RemoveUsingContainerIndex( mImpl->nodes, node );
 
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), node );
 
@@ -474,9 +515,28 @@ void UpdateManager::DestroyNode( Node* node )
   node->OnDestroy();
 }
 
+void UpdateManager::DestroyNodes( OwnerPointer< NodeContainer >& nodes )
+{
+  const BufferIndex updateBufferIndex = mSceneGraphBuffers.GetUpdateBufferIndex();
+
+  for( auto&& node : *nodes )
+  {
+    DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should have been disconnected
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] DestroyNode\n", node );
+
+    RemoveUsingContainerIndex( mImpl->nodes, node );
+
+    mImpl->discardQueue.Add( updateBufferIndex, node );
+
+    // Notify the Node about impending destruction
+    node->OnDestroy();
+  }
+}
+
 void UpdateManager::AddCamera( OwnerPointer< Camera >& camera )
 {
-  mImpl->cameras.PushBack( camera.Release() ); // takes ownership
+  AddUsingContainerIndex( mImpl->cameras, camera.Release() ); // takes ownership
 }
 
 void UpdateManager::RemoveCamera( Camera* camera )
@@ -564,10 +624,12 @@ void UpdateManager::AddPropertyResetter( OwnerPointer<PropertyResetterBase>& pro
 void UpdateManager::AddPropertyNotification( OwnerPointer< PropertyNotification >& propertyNotification )
 {
   mImpl->propertyNotifications.PushBack( propertyNotification.Release() );
+  mImpl->propertyNotificationIndex.SetDirty();
 }
 
 void UpdateManager::RemovePropertyNotification( PropertyNotification* propertyNotification )
 {
+  mImpl->propertyNotificationIndex.SetDirty();
   mImpl->propertyNotifications.EraseObject( propertyNotification );
 }
 
@@ -579,7 +641,7 @@ void UpdateManager::PropertyNotificationSetNotify( PropertyNotification* propert
 
 void UpdateManager::AddShader( OwnerPointer< Shader >& shader )
 {
-  mImpl->shaders.PushBack( shader.Release() );
+  AddUsingContainerIndex( mImpl->shaders, shader.Release() );
 }
 
 void UpdateManager::RemoveShader( Shader* shader )
@@ -625,7 +687,7 @@ void UpdateManager::AddRenderer( OwnerPointer< Renderer >& renderer )
   DALI_LOG_INFO( gLogFilter, Debug::General, "[%x] AddRenderer\n", renderer.Get() );
 
   renderer->ConnectToSceneGraph( *mImpl->sceneController, mSceneGraphBuffers.GetUpdateBufferIndex() );
-  mImpl->renderers.PushBack( renderer.Release() );
+  AddUsingContainerIndex( mImpl->renderers, renderer.Release() );
   mImpl->renderersAdded = true;
 }
 
@@ -648,12 +710,13 @@ void UpdateManager::SetPanGestureProcessor( PanGesture* panGestureProcessor )
 
 void UpdateManager::AddTextureSet( OwnerPointer< TextureSet >& textureSet )
 {
-  mImpl->textureSets.PushBack( textureSet.Release() );
+  AddUsingContainerIndex( mImpl->textureSets, textureSet.Release() );
 }
 
 void UpdateManager::RemoveTextureSet( TextureSet* textureSet )
 {
-  mImpl->textureSets.EraseObject( textureSet );
+  RemoveUsingContainerIndex( mImpl->textureSets, textureSet );
+  delete textureSet;
 }
 
 uint32_t* UpdateManager::ReserveMessageSlot( uint32_t size, bool updateScene )
@@ -661,6 +724,21 @@ uint32_t* UpdateManager::ReserveMessageSlot( uint32_t size, bool updateScene )
   return mImpl->messageQueue.ReserveMessageSlot( size, updateScene );
 }
 
+uint32_t* UpdateManager::ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene )
+{
+  return mImpl->messageQueue.ReserveCoalescableMessageSlot( property, size, updateScene );
+}
+
+void UpdateManager::SetMessageCoalescing( bool enabled )
+{
+  mImpl->messageQueue.SetMessageCoalescing( enabled );
+}
+
+uint32_t UpdateManager::GetCoalescedMessageCount() const
+{
+  return mImpl->messageQueue.GetCoalescedMessageCount();
+}
+
 void UpdateManager::EventProcessingStarted()
 {
   mImpl->messageQueue.EventProcessingStarted();
@@ -701,7 +779,7 @@ void UpdateManager::ResetProperties( BufferIndex bufferIndex )
   }
 
   // Clear node dirty flags
-  Vector<Node*>::Iterator iter = mImpl->nodes.Begin()+1;
+  Vector<Node*>::Iterator iter = mImpl->nodes.Begin();
   Vector<Node*>::Iterator endIter = mImpl->nodes.End();
   for( ;iter != endIter; ++iter )
   {
@@ -728,13 +806,16 @@ void UpdateManager::Animate( BufferIndex bufferIndex, float elapsedSeconds )
   auto&& iter = mImpl->animations.Begin();
   bool animationLooped = false;
 
+  // When parallel animation is enabled, the animators are applied after all the animations have been updated
+  AnimatorUpdateContainer* animatorUpdates = ( mImpl->animationThreadCount > 0u ) ? &mImpl->animatorUpdates : nullptr;
+
   while ( iter != mImpl->animations.End() )
   {
     Animation* animation = *iter;
     bool finished = false;
     bool looped = false;
     bool progressMarkerReached = false;
-    animation->Update( bufferIndex, elapsedSeconds, looped, finished, progressMarkerReached );
+    animation->Update( bufferIndex, elapsedSeconds, looped, finished, progressMarkerReached, animatorUpdates );
 
     if ( progressMarkerReached )
     {
@@ -745,6 +826,7 @@ void UpdateManager::Animate( BufferIndex bufferIndex, float elapsedSeconds )
     animationLooped = animationLooped || looped;
 
     // Remove animations that had been destroyed but were still waiting for an update
+    // A destroyed animation does not update its animators, so none of them can be in animatorUpdates
     if (animation->GetState() == Animation::Destroyed)
     {
       iter = mImpl->animations.Erase(iter);
@@ -755,6 +837,11 @@ void UpdateManager::Animate( BufferIndex bufferIndex, float elapsedSeconds )
     }
   }
 
+  if( animatorUpdates )
+  {
+    ApplyAnimatorUpdates( bufferIndex );
+  }
+
   // queue the notification on finished or looped (to update loop count)
   if ( mImpl->animationFinishedDuringUpdate || animationLooped )
   {
@@ -763,6 +850,65 @@ void UpdateManager::Animate( BufferIndex bufferIndex, float elapsedSeconds )
   }
 }
 
+void UpdateManager::ApplyAnimatorUpdates( BufferIndex bufferIndex )
+{
+  AnimatorUpdateContainer& updates = mImpl->animatorUpdates;
+  const uint32_t updateCount = static_cast<uint32_t>( updates.Count() );
+  const uint32_t taskCount = std::min( mImpl->animationThreadCount + 1u, updateCount / MINIMUM_ANIMATORS_PER_TASK );
+
+  if( ( updateCount < mImpl->parallelAnimationThreshold ) || ( taskCount < 2u ) )
+  {
+    for( auto&& update : updates )
+    {
+      update.animator->Update( bufferIndex, update.progress, update.bake );
+    }
+    updates.Clear();
+    return;
+  }
+
+  // The animators of a property owner go to the same task, in the order they were recorded; an animator
+  // only writes the properties of its owner, so the results are the same as when updated serially
+  std::vector< Vector< uint32_t > >& tasks = mImpl->animatorTasks;
+  tasks.resize( taskCount );
+  for( auto&& task : tasks )
+  {
+    task.Clear();
+  }
+  for( uint32_t i = 0u; i < updateCount; ++i )
+  {
+    tasks[ GetAnimatorTask( updates[i].animator->GetPropertyOwner(), taskCount ) ].PushBack( i );
+  }
+
+  auto applyTask = [&updates, bufferIndex]( const Vector< uint32_t >& task )
+  {
+    for( auto&& index : task )
+    {
+      const AnimatorUpdate& update = updates[index];
+      update.animator->Update( bufferIndex, update.progress, update.bake );
+    }
+  };
+
+  //The last task is applied in this thread while the workers apply the others
+  std::vector< Dali::Task > workerTasks;
+  workerTasks.reserve( taskCount - 1u );
+  for( uint32_t task = 0u; task < taskCount - 1u; ++task )
+  {
+    const Vector< uint32_t >* indices = &tasks[task];
+    workerTasks.push_back( [&applyTask, indices]( uint32_t )
+    {
+      applyTask( *indices );
+    } );
+  }
+
+  Dali::UniqueFutureGroup futures = mImpl->threadPool->SubmitTasks( workerTasks, taskCount - 1u );
+
+  applyTask( tasks[taskCount - 1u] );
+
+  futures->Wait();
+
+  updates.Clear();
+}
+
 void UpdateManager::ConstrainCustomObjects( BufferIndex bufferIndex )
 {
   //Constrain custom objects (in construction order)
@@ -790,7 +936,7 @@ void UpdateManager::ConstrainRenderTasks( BufferIndex bufferIndex )
 
 void UpdateManager::ConstrainShaders( BufferIndex bufferIndex )
 {
-  // constrain shaders... (in construction order)
+  // constrain shaders...
   for ( auto&& shader : mImpl->shaders )
   {
     ConstrainPropertyOwner( *shader, bufferIndex );
@@ -799,14 +945,16 @@ void UpdateManager::ConstrainShaders( BufferIndex bufferIndex )
 
 void UpdateManager::ProcessPropertyNotifications( BufferIndex bufferIndex )
 {
-  for( auto&& notification : mImpl->propertyNotifications )
+  // Only the notifications of the properties which changed in this frame are checked
+  mImpl->propertyNotificationIndex.Check( mImpl->propertyNotifications, bufferIndex, mImpl->notifiedPropertyNotifications );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Property notifications checked: %u of %u\n",
+                 mImpl->propertyNotificationIndex.GetCheckedCount(), static_cast<uint32_t>( mImpl->propertyNotifications.Count() ) );
+
+  for( auto&& notification : mImpl->notifiedPropertyNotifications )
   {
-    bool valid = notification->Check( bufferIndex );
-    if(valid)
-    {
-      mImpl->notificationManager.QueueMessage( PropertyChangedMessage( mImpl->propertyNotifier, notification, notification->GetValidity() ) );
-    }
+    mImpl->notificationManager.QueueMessage( PropertyChangedMessage( mImpl->propertyNotifier, notification, notification->GetValidity() ) );
   }
+  mImpl->notifiedPropertyNotifications.Clear();
 }
 
 void UpdateManager::ForwardCompiledShadersToEventThread()
@@ -944,8 +1092,10 @@ uint32_t UpdateManager::Update( float elapsedSeconds,
     //Update renderers and apply constraints
     UpdateRenderers( bufferIndex );
 
-    //Update the transformations of all the nodes
+    //Update the transformations of the nodes which have changed
     mImpl->transformManager.Update();
+    mImpl->transformManager.UpdateSubtreeBoundingSpheres( bufferIndex );
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Transforms updated: %u\n", mImpl->transformManager.GetUpdatedComponentCount() );
 
     //Process Property Notifications
     ProcessPropertyNotifications( bufferIndex );
@@ -1120,6 +1270,43 @@ void UpdateManager::SetRenderingBehavior( DevelStage::Rendering renderingBehavio
   mImpl->renderingBehavior = renderingBehavior;
 }
 
+void UpdateManager::SetParallelTransformUpdate( uint32_t threadCount, uint32_t componentThreshold )
+{
+  mImpl->transformThreadCount = threadCount;
+  mImpl->transformComponentThreshold = componentThreshold;
+  UpdateThreadPool();
+}
+
+void UpdateManager::SetParallelAnimation( uint32_t threadCount, uint32_t animatorThreshold )
+{
+  mImpl->animationThreadCount = threadCount;
+  mImpl->parallelAnimationThreshold = animatorThreshold;
+  UpdateThreadPool();
+}
+
+void UpdateManager::UpdateThreadPool()
+{
+  // The transforms and the animators are updated one after the other, so one pool serves both
+  const uint32_t threadCount = std::max( mImpl->transformThreadCount, mImpl->animationThreadCount );
+
+  if( threadCount == 0u )
+  {
+    mImpl->threadPool.reset();
+  }
+  else if( !mImpl->threadPool || ( mImpl->threadPool->GetWorkerCount() != threadCount ) )
+  {
+    mImpl->threadPool.reset( new Dali::ThreadPool() );
+    mImpl->threadPool->Initialize( threadCount );
+  }
+
+  mImpl->transformManager.SetParallelUpdate( mImpl->threadPool.get(), mImpl->transformThreadCount, mImpl->transformComponentThreshold );
+}
+
+void UpdateManager::SetHitTestAcceleration( bool enabled )
+{
+  mImpl->transformManager.SetSubtreeBoundsEnabled( enabled );
+}
+
 void UpdateManager::SetLayerDepths( const SortedLayerPointers& layers, const Layer* rootLayer )
 {
   for ( auto&& scene : mImpl->scenes )
@@ -200,6 +200,14 @@ public:
    */
   void DestroyNode( Node* node );
 
+  /**
+   * Destroy a batch of Nodes owned by UpdateManager, e.g. the nodes of an actor sub-tree which is destroyed at once.
+   * This is equivalent to calling DestroyNode for each node in turn, but takes a single message.
+   * @pre The nodes have been disconnected from the scene-graph.
+   * @param[in] nodes The nodes to destroy.
+   */
+  void DestroyNodes( OwnerPointer< NodeContainer >& nodes );
+
   /**
    * Add a camera on scene
    * @param[in] camera The camera to add
@@ -395,6 +403,24 @@ public:
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene = true );
 
+  /**
+   * @copydoc EventThreadServices::ReserveCoalescableMessageSlot
+   * @note the default value of updateScene should match that in EventThreadServices::ReserveCoalescableMessageSlot.
+   */
+  uint32_t* ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene = true );
+
+  /**
+   * @copydoc Dali::DevelStage::SetMessageCoalescing()
+   * @note Called from the event-thread.
+   */
+  void SetMessageCoalescing( bool enabled );
+
+  /**
+   * @copydoc Dali::DevelStage::GetCoalescedMessageCount()
+   * @note Called from the event-thread.
+   */
+  uint32_t GetCoalescedMessageCount() const;
+
   /**
    * @return the current event-buffer index.
    */
@@ -615,6 +641,21 @@ public:
    */
   void SetRenderingBehavior( DevelStage::Rendering renderingBehavior );
 
+  /**
+   * @copydoc Dali::DevelStage::SetParallelTransformUpdate()
+   */
+  void SetParallelTransformUpdate( uint32_t threadCount, uint32_t componentThreshold );
+
+  /**
+   * @copydoc Dali::DevelStage::SetParallelAnimation()
+   */
+  void SetParallelAnimation( uint32_t threadCount, uint32_t animatorThreshold );
+
+  /**
+   * @copydoc Dali::DevelStage::SetHitTestAcceleration()
+   */
+  void SetHitTestAcceleration( bool enabled );
+
   /**
    * Sets the depths of all layers.
    * @param layers The layers in depth order.
@@ -684,6 +725,18 @@ private:
    */
   void Animate( BufferIndex bufferIndex, float elapsedSeconds );
 
+  /**
+   * Applies the animator updates recorded by Animate() when parallel animation is enabled.
+   * The updates are split by property owner, so each property is written by one thread, in the same order as the serial update.
+   * @param[in] bufferIndex to use
+   */
+  void ApplyAnimatorUpdates( BufferIndex bufferIndex );
+
+  /**
+   * Creates, resizes or destroys the worker threads shared by the parallel transform update and animation.
+   */
+  void UpdateThreadPool();
+
   /**
    * Applies constraints to CustomObjects
    * @param[in] bufferIndex to use
@@ -818,6 +871,18 @@ inline void DestroyNodeMessage( UpdateManager& manager, const Node& constNode )
   new (slot) LocalType( &manager, &UpdateManager::DestroyNode, &node );
 }
 
+inline void DestroyNodesMessage( UpdateManager& manager, OwnerPointer< NodeContainer >& nodes )
+{
+  // Message has ownership of the container while in transit from event -> update
+  typedef MessageValue1< UpdateManager, OwnerPointer< NodeContainer > > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::DestroyNodes, nodes );
+}
+
 inline void AddCameraMessage( UpdateManager& manager, OwnerPointer< Camera >& camera )
 {
   // Message has ownership of Camera while in transit from event -> update
@@ -1052,6 +1117,39 @@ inline void SetRenderingBehaviorMessage( UpdateManager& manager, DevelStage::Ren
   new (slot) LocalType( &manager, &UpdateManager::SetRenderingBehavior, renderingBehavior );
 }
 
+inline void SetParallelTransformUpdateMessage( UpdateManager& manager, uint32_t threadCount, uint32_t componentThreshold )
+{
+  typedef MessageValue2< UpdateManager, uint32_t, uint32_t > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetParallelTransformUpdate, threadCount, componentThreshold );
+}
+
+inline void SetParallelAnimationMessage( UpdateManager& manager, uint32_t threadCount, uint32_t animatorThreshold )
+{
+  typedef MessageValue2< UpdateManager, uint32_t, uint32_t > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetParallelAnimation, threadCount, animatorThreshold );
+}
+
+inline void SetHitTestAccelerationMessage( UpdateManager& manager, bool enabled )
+{
+  typedef MessageValue1< UpdateManager, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = manager.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetHitTestAcceleration, enabled );
+}
+
 /**
  * Create a message for setting the depth of a layer
  * @param[in] manager The update manager
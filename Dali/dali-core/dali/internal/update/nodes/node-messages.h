@@ -86,8 +86,9 @@ public:
                     MemberFunction member,
                     typename ParameterType< P >::PassingType value )
   {
-    // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
+    // Reserve some memory inside the message queue; a pending bake of the same property may be replaced
+    uint32_t* slot = ( member == &AnimatableProperty<P>::Bake ) ? eventThreadServices.ReserveCoalescableMessageSlot( property, sizeof( NodePropertyMessage ) )
+                                                                : eventThreadServices.ReserveMessageSlot( sizeof( NodePropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodePropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
@@ -246,8 +247,9 @@ public:
                     MemberFunction member,
                     const P& value )
   {
-    // Reserve some memory inside the message queue
-    uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
+    // Reserve some memory inside the message queue; a pending bake of the same property may be replaced
+    uint32_t* slot = ( member == &TransformManagerPropertyHandler<P>::Bake ) ? eventThreadServices.ReserveCoalescableMessageSlot( property, sizeof( NodeTransformPropertyMessage ) )
+                                                                             : eventThreadServices.ReserveMessageSlot( sizeof( NodeTransformPropertyMessage ) );
 
     // Construct message in the message queue memory; note that delete should not be called on the return value
     new (slot) NodeTransformPropertyMessage( eventThreadServices.GetUpdateManager(), node, property, member, value );
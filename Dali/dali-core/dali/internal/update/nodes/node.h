@@ -31,6 +31,7 @@
 #include <dali/internal/update/common/animatable-property.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/scene-graph-buffers.h>
+#include <dali/internal/update/common/scene-graph-container-index.h>
 #include <dali/internal/update/common/inherited-property.h>
 #include <dali/internal/update/manager/transform-manager.h>
 #include <dali/internal/update/manager/transform-manager-property.h>
@@ -57,7 +58,7 @@ class UpdateManager;
 
 
 // Flags which require the scene renderable lists to be updated
-static NodePropertyFlags RenderableUpdateFlags = NodePropertyFlags::TRANSFORM | NodePropertyFlags::CHILD_DELETED;
+static NodePropertyFlags RenderableUpdateFlags = NodePropertyFlags::TRANSFORM | NodePropertyFlags::CHILD_DELETED | NodePropertyFlags::DEPTH_INDEX;
 
 /**
  * Node is the base class for all nodes in the Scene Graph.
@@ -67,7 +68,7 @@ static NodePropertyFlags RenderableUpdateFlags = NodePropertyFlags::TRANSFORM |
  * thread to modify node data, without interferring with another
  * thread reading the values from the previous update traversal.
  */
-class Node : public PropertyOwner, public NodeDataProvider
+class Node : public PropertyOwner, public NodeDataProvider, public ContainerIndex
 {
 public:
 
@@ -338,6 +339,16 @@ public:
    */
   NodePropertyFlags GetInheritedDirtyFlags( NodePropertyFlags parentFlags ) const;
 
+  /**
+   * Query whether any property affecting how the node's renderers look (other than the transform) has changed.
+   * This is used to find the area of the surface which must be redrawn in a partial update.
+   * @return True if the world color, the depth index (e.g. the sibling order) or any custom property has changed.
+   */
+  bool Updated() const
+  {
+    return !mWorldColor.IsClean() || ( mDirtyFlags & NodePropertyFlags::DEPTH_INDEX ) || IsAnyCustomPropertyDirty();
+  }
+
   /**
    * Retrieve the parent-origin of the node.
    * @return The parent-origin.
@@ -627,6 +638,17 @@ public:
     return Vector4::ZERO;
   }
 
+  /**
+   * Retrieve the bounding sphere of the node and all its descendants, as computed by the transform manager
+   * @param[in] bufferIndex The buffer to read from
+   * @param[out] sphere XYZ is the center and W is the radius, which is infinite if the sub-tree is unbounded
+   * @return false if the sphere is not available
+   */
+  bool GetSubtreeBoundingSphere( BufferIndex bufferIndex, Vector4& sphere ) const
+  {
+    return ( mTransformId != INVALID_TRANSFORM_ID ) && mTransformManager->GetSubtreeBoundingSphere( bufferIndex, mTransformId, sphere );
+  }
+
   /**
    * Retrieve world matrix and size of the node
    * @param[out] The local to world matrix of the node
@@ -720,7 +742,12 @@ public:
    */
   void SetDepthIndex( uint32_t depthIndex )
   {
-    mDepthIndex = depthIndex;
+    if( depthIndex != mDepthIndex )
+    {
+      // The sort order of the layer changes, so its cached render items cannot be reused
+      SetDirtyFlag( NodePropertyFlags::DEPTH_INDEX );
+      mDepthIndex = depthIndex;
+    }
   }
 
   /**
@@ -752,7 +779,8 @@ public:
    */
   void SetCulled( BufferIndex bufferIndex, bool culled )
   {
-    mCulled[bufferIndex] = culled;
+    // Set() flags the change, so the property notifications of CULLED are checked
+    mCulled.Set( bufferIndex, culled );
   }
 
   /**
@@ -46,6 +46,7 @@ Layer::Layer()
   mBehavior( Dali::Layer::LAYER_UI ),
   mIsClipping( false ),
   mDepthTestDisabled( true ),
+  mSortByRenderState( false ),
   mIsDefaultSortFunction( true )
 {
   // set a flag the node to say this is a layer
@@ -106,6 +107,17 @@ bool Layer::IsDepthTestDisabled() const
   return mDepthTestDisabled;
 }
 
+void Layer::SetSortByRenderState( bool enable )
+{
+  if( mSortByRenderState != enable )
+  {
+    // changing the sort order makes the layer dirty
+    mAllChildTransformsClean[ 0 ] = false;
+    mAllChildTransformsClean[ 1 ] = false;
+    mSortByRenderState = enable;
+  }
+}
+
 void Layer::ClearRenderables()
 {
   colorRenderables.Clear();
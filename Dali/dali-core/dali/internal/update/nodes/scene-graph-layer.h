@@ -167,6 +167,21 @@ public:
    */
   bool IsDepthTestDisabled() const;
 
+  /**
+   * Sets whether the opaque renderers are sorted to minimise render state changes.
+   * @param[in] enable True to sort by render state
+   */
+  void SetSortByRenderState( bool enable );
+
+  /**
+   * Queries whether the opaque renderers are sorted to minimise render state changes.
+   * @return True if sorting by render state
+   */
+  bool IsSortByRenderState() const
+  {
+    return mSortByRenderState;
+  }
+
   /**
    * Enables the reuse of the model view matrices of all renderers for this layer
    * @param[in] updateBufferIndex The current update buffer index.
@@ -239,6 +254,7 @@ private:
                                       ///  this allows us to cache render items when layer is "static"
   bool mIsClipping:1;                 ///< True when clipping is enabled
   bool mDepthTestDisabled:1;          ///< Whether depth test is disabled.
+  bool mSortByRenderState:1;          ///< Whether opaque renderers are sorted by render state
   bool mIsDefaultSortFunction:1;      ///< whether the default depth sort function is used
 
 };
@@ -330,6 +346,25 @@ inline void SetDepthTestDisabledMessage( EventThreadServices& eventThreadService
   new (slot) LocalType( &layer, &Layer::SetDepthTestDisabled, disable );
 }
 
+/**
+ * Create a message for enabling/disabling the sorting of opaque renderers by render state.
+ *
+ * @see Dali::DevelLayer::Property::SORT_BY_RENDER_STATE
+ *
+ * @param[in] layer The layer
+ * @param[in] enable \e true sorts the opaque renderers by render state.
+ */
+inline void SetSortByRenderStateMessage( EventThreadServices& eventThreadServices, const Layer& layer, bool enable )
+{
+  typedef MessageValue1< Layer, bool > LocalType;
+
+  // Reserve some memory inside the message queue
+  uint32_t* slot = eventThreadServices.ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &layer, &Layer::SetSortByRenderState, enable );
+}
+
 } // namespace SceneGraph
 
 // Template specialisation for OwnerPointer<Layer>, because delete is protected
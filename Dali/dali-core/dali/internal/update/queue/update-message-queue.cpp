@@ -18,9 +18,14 @@
 // CLASS HEADER
 #include <dali/internal/update/queue/update-message-queue.h>
 
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
-#include <dali/devel-api/threading/mutex.h>
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/render-controller.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/message-buffer.h>
@@ -40,17 +45,124 @@ namespace Internal
 namespace // unnamed namespace
 {
 
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_UPDATE_MESSAGE_QUEUE" );
+#endif
+
 // A message to set Actor::SIZE is 72 bytes on 32bit device
 // A buffer of size 32768 would store (32768 - 4) / (72 + 4) = 431 of those messages
 static const std::size_t INITIAL_BUFFER_SIZE =  32768;
 static const std::size_t MAX_BUFFER_CAPACITY = 73728; // Avoid keeping buffers which exceed this
 static const std::size_t MAX_FREE_BUFFER_COUNT = 3; // Allow this number of buffers to be recycled
+static const uint32_t RING_CAPACITY = 32u; // Number of flushed buffers which can wait for the update thread; must be a power of two
 
 // A queue of message buffers
 typedef vector< MessageBuffer* > MessageBufferQueue;
 typedef MessageBufferQueue::iterator MessageBufferIter;
 
-typedef Dali::Mutex MessageQueueMutex;
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * A flushed buffer waiting to be processed.
+ */
+struct QueuedBuffer
+{
+  MessageBuffer*    buffer;      ///< The messages
+  bool              sceneUpdate; ///< Whether any of the messages requires a scene-graph node tree update
+  Clock::time_point flushTime;   ///< When the buffer was flushed, to measure the latency of the queue
+};
+
+/**
+ * A message, waiting in the current buffer, which may be dropped in favour of a later one for the same property.
+ */
+struct PendingMessage
+{
+  std::size_t offset; ///< The position of the message in the current buffer
+  uint32_t    size;   ///< The size of the message
+  uint32_t    serial; ///< The number of messages reserved before this one
+};
+
+typedef std::unordered_map< const void*, PendingMessage > PendingMessageContainer;
+
+/**
+ * Replaces a message which has been superseded by a later message for the same property.
+ */
+class DroppedMessage : public MessageBase
+{
+public:
+
+  /**
+   * @copydoc MessageBase::Process
+   */
+  void Process( BufferIndex /*bufferIndex*/ ) override
+  {
+  }
+};
+
+/**
+ * A lock-free ring for passing items from exactly one producer thread to exactly one consumer thread.
+ * The producer owns mTail and the consumer owns mHead; each only reads the index owned by the other thread.
+ */
+template< typename T >
+class SingleProducerSingleConsumerRing
+{
+public:
+
+  SingleProducerSingleConsumerRing()
+  : mHead( 0u ),
+    mTail( 0u )
+  {
+  }
+
+  /**
+   * Called from the producer thread
+   * @return false if the ring is full
+   */
+  bool Push( const T& item )
+  {
+    const uint32_t tail = mTail.load( std::memory_order_relaxed );
+    if( tail - mHead.load( std::memory_order_acquire ) == RING_CAPACITY )
+    {
+      return false;
+    }
+    mItems[ tail & ( RING_CAPACITY - 1u ) ] = item;
+    mTail.store( tail + 1u, std::memory_order_release ); // publish the item
+    return true;
+  }
+
+  /**
+   * Called from the consumer thread
+   * @return false if the ring is empty
+   */
+  bool Pop( T& item )
+  {
+    const uint32_t head = mHead.load( std::memory_order_relaxed );
+    if( head == mTail.load( std::memory_order_acquire ) )
+    {
+      return false;
+    }
+    item = mItems[ head & ( RING_CAPACITY - 1u ) ];
+    mHead.store( head + 1u, std::memory_order_release ); // give the slot back to the producer
+    return true;
+  }
+
+private:
+
+  T mItems[ RING_CAPACITY ];
+  std::atomic< uint32_t > mHead; ///< Index of the next item to pop, written by the consumer
+  std::atomic< uint32_t > mTail; ///< Index of the next item to push, written by the producer
+};
+
+void DeleteBufferContents( MessageBuffer* buffer )
+{
+  for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+  {
+    MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
+
+    // Call virtual destructor explictly; since delete will not be called after placement new
+    message->~MessageBase();
+  }
+}
 
 } // unnamed namespace
 
@@ -68,8 +180,17 @@ struct MessageQueue::Impl
     processingEvents(false),
     queueWasEmpty(true),
     sceneUpdateFlag( false ),
-    sceneUpdate( 0 ),
-    currentMessageBuffer(NULL)
+    sceneUpdateProcessed( false ),
+    queuedSceneUpdates( 0u ),
+    currentMessageBuffer(NULL),
+    messageCoalescing( false ),
+    messageSerial( 0u ),
+    coalescedMessageCount( 0u ),
+    flushCount( 0u ),
+    deferredFlushCount( 0u ),
+    processedBufferCount( 0u ),
+    totalLatency( Clock::duration::zero() ),
+    maxLatency( Clock::duration::zero() )
   {
   }
 
@@ -83,20 +204,17 @@ struct MessageQueue::Impl
     }
 
     // Delete the unprocessed buffers
-    const MessageBufferIter processQueueEndIter = processQueue.end();
-    for ( MessageBufferIter iter = processQueue.begin(); iter != processQueueEndIter; ++iter )
+    QueuedBuffer unprocessed;
+    while( processRing.Pop( unprocessed ) )
     {
-      MessageBuffer* unprocessedBuffer = *iter;
-      DeleteBufferContents( unprocessedBuffer );
-      delete unprocessedBuffer;
+      DeleteBufferContents( unprocessed.buffer );
+      delete unprocessed.buffer;
     }
 
-    // Delete the recycled buffers
-    const MessageBufferIter recycleQueueEndIter = recycleQueue.end();
-    for ( MessageBufferIter iter = recycleQueue.begin(); iter != recycleQueueEndIter; ++iter )
+    // Delete the recycled buffers; these have been reset already
+    MessageBuffer* recycledBuffer = NULL;
+    while( recycleRing.Pop( recycledBuffer ) )
     {
-      MessageBuffer* recycledBuffer = *iter;
-      DeleteBufferContents( recycledBuffer );
       delete recycledBuffer;
     }
 
@@ -109,31 +227,32 @@ struct MessageQueue::Impl
     }
   }
 
-  void DeleteBufferContents( MessageBuffer* buffer )
-  {
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
-    {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
-
-      // Call virtual destructor explictly; since delete will not be called after placement new
-      message->~MessageBase();
-    }
-  }
-
   RenderController&        renderController;     ///< render controller
   const SceneGraphBuffers& sceneGraphBuffers;    ///< Used to keep track of which buffers are being written or read.
 
   bool                     processingEvents;     ///< Whether messages queued will be flushed by core
   bool                     queueWasEmpty;        ///< Flag whether the queue was empty during the Update()
   bool                     sceneUpdateFlag;      ///< true when there is a new message that requires a scene-graph node tree update
-  int                      sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
-
-  MessageQueueMutex        queueMutex;           ///< queueMutex must be locked whilst accessing processQueue or recycleQueue
-  MessageBufferQueue       processQueue;         ///< to process in the next update
-  MessageBufferQueue       recycleQueue;         ///< to recycle MessageBuffers after the messages have been processed
-
-  MessageBuffer*           currentMessageBuffer; ///< can be used without locking
-  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; can be used without locking
+  bool                     sceneUpdateProcessed; ///< true when the last ProcessMessages() processed a message requiring a scene-graph node tree update; update thread only
+  std::atomic< uint32_t >  queuedSceneUpdates;   ///< The number of flushed buffers, not yet processed, requiring a scene-graph node tree update
+
+  SingleProducerSingleConsumerRing< QueuedBuffer >   processRing; ///< to process in the next update; event thread to update thread
+  SingleProducerSingleConsumerRing< MessageBuffer* > recycleRing; ///< to recycle MessageBuffers after the messages have been processed; update thread to event thread
+
+  MessageBuffer*           currentMessageBuffer; ///< event thread only
+  MessageBufferQueue       freeQueue;            ///< buffers from the recycleRing; event thread only
+
+  bool                     messageCoalescing;     ///< Whether messages for the same property are coalesced; event thread only
+  PendingMessageContainer  pendingMessages;       ///< The coalescable messages in currentMessageBuffer, by property; event thread only
+  uint32_t                 messageSerial;         ///< The number of messages reserved; event thread only
+  uint32_t                 coalescedMessageCount; ///< The number of messages dropped by coalescing; event thread only
+
+  // Statistics, logged by the update thread
+  std::atomic< uint32_t >  flushCount;           ///< Number of buffers flushed by the event thread
+  std::atomic< uint32_t >  deferredFlushCount;   ///< Number of flushes deferred because the update thread had not caught up
+  uint32_t                 processedBufferCount; ///< Number of buffers processed by the update thread
+  Clock::duration          totalLatency;         ///< Total time between the flush and the processing of the buffers; update thread only
+  Clock::duration          maxLatency;           ///< Longest time between the flush and the processing of a buffer; update thread only
 };
 
 MessageQueue::MessageQueue( Integration::RenderController& controller, const SceneGraph::SceneGraphBuffers& buffers )
@@ -196,9 +315,61 @@ uint32_t* MessageQueue::ReserveMessageSlot( uint32_t requestedSize, bool updateS
     mImpl->renderController.RequestProcessEventsOnIdle( false );
   }
 
+  ++mImpl->messageSerial;
+
   return mImpl->currentMessageBuffer->ReserveMessageSlot( requestedSize );
 }
 
+// Called from event thread
+uint32_t* MessageQueue::ReserveCoalescableMessageSlot( const void* property, uint32_t requestedSize, bool updateScene )
+{
+  if( !mImpl->messageCoalescing )
+  {
+    return ReserveMessageSlot( requestedSize, updateScene );
+  }
+
+  PendingMessageContainer::iterator pending = mImpl->pendingMessages.find( property );
+  if( pending != mImpl->pendingMessages.end() )
+  {
+    uint32_t* slot = mImpl->currentMessageBuffer->GetMessageSlot( pending->second.offset );
+
+    // Call virtual destructor explictly; since delete will not be called after placement new
+    reinterpret_cast< MessageBase* >( slot )->~MessageBase();
+    ++mImpl->coalescedMessageCount;
+
+    if( pending->second.serial == mImpl->messageSerial && pending->second.size == requestedSize )
+    {
+      // No other message has been reserved since, so the new message can take the place of the old one
+      if( updateScene )
+      {
+        mImpl->sceneUpdateFlag = true;
+      }
+      return slot;
+    }
+
+    // Keep the order of the other messages; the slot is skipped when the buffer is processed
+    new (slot) DroppedMessage();
+  }
+
+  uint32_t* slot = ReserveMessageSlot( requestedSize, updateScene );
+
+  const PendingMessage message = { mImpl->currentMessageBuffer->GetMessageOffset( slot ), requestedSize, mImpl->messageSerial };
+  mImpl->pendingMessages[ property ] = message;
+
+  return slot;
+}
+
+void MessageQueue::SetMessageCoalescing( bool enabled )
+{
+  mImpl->messageCoalescing = enabled; // called from event thread
+  mImpl->pendingMessages.clear();
+}
+
+uint32_t MessageQueue::GetCoalescedMessageCount() const
+{
+  return mImpl->coalescedMessageCount; // called from event thread
+}
+
 // Called from event thread
 bool MessageQueue::FlushQueue()
 {
@@ -207,18 +378,36 @@ bool MessageQueue::FlushQueue()
   // If there're messages to flush
   if ( messagesToProcess )
   {
-    // queueMutex must be locked whilst accessing processQueue or recycleQueue
-    MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+    QueuedBuffer queued = { mImpl->currentMessageBuffer, mImpl->sceneUpdateFlag, Clock::now() };
 
-    mImpl->processQueue.push_back( mImpl->currentMessageBuffer );
-    mImpl->currentMessageBuffer = NULL;
+    // Count the scene update before publishing the buffer, so the update thread never sees the buffer without it
+    if( queued.sceneUpdate )
+    {
+      mImpl->queuedSceneUpdates.fetch_add( 1u, std::memory_order_relaxed );
+    }
 
-    // Grab any recycled MessageBuffers
-    while ( !mImpl->recycleQueue.empty() )
+    if( mImpl->processRing.Push( queued ) )
+    {
+      mImpl->currentMessageBuffer = NULL;
+      mImpl->sceneUpdateFlag = false;
+      mImpl->pendingMessages.clear();
+      mImpl->flushCount.fetch_add( 1u, std::memory_order_relaxed );
+    }
+    else
     {
-      MessageBuffer* recycled = mImpl->recycleQueue.back();
-      mImpl->recycleQueue.pop_back();
+      // The update thread has not caught up; keep adding to the current buffer and flush it next time
+      if( queued.sceneUpdate )
+      {
+        mImpl->queuedSceneUpdates.fetch_sub( 1u, std::memory_order_relaxed );
+      }
+      mImpl->deferredFlushCount.fetch_add( 1u, std::memory_order_relaxed );
+      mImpl->renderController.RequestProcessEventsOnIdle( false );
+    }
 
+    // Grab any recycled MessageBuffers
+    MessageBuffer* recycled = NULL;
+    while ( mImpl->recycleRing.Pop( recycled ) )
+    {
       // Guard against excessive message buffer growth
       if ( MAX_FREE_BUFFER_COUNT < mImpl->freeQueue.size() ||
            MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
@@ -230,16 +419,12 @@ bool MessageQueue::FlushQueue()
         mImpl->freeQueue.push_back( recycled );
       }
     }
-
-    if( mImpl->sceneUpdateFlag )
-    {
-      mImpl->sceneUpdate |= 2;
-      mImpl->sceneUpdateFlag = false;
-    }
   }
 
   mImpl->processingEvents = false;
 
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Coalesced: %u\n", mImpl->coalescedMessageCount );
+
   return messagesToProcess;
 }
 
@@ -247,13 +432,14 @@ bool MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
 {
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
-  // queueMutex must be locked whilst accessing queue
-  MessageQueueMutex::ScopedLock lock( mImpl->queueMutex );
+  bool processed = false;
+  uint32_t sceneUpdates = 0u;
+  const Clock::time_point processTime = Clock::now();
 
-  const MessageBufferIter processQueueEndIter = mImpl->processQueue.end();
-  for ( MessageBufferIter iter = mImpl->processQueue.begin(); iter != processQueueEndIter ; ++iter )
+  QueuedBuffer queued;
+  while( mImpl->processRing.Pop( queued ) )
   {
-    MessageBuffer* buffer = *iter;
+    MessageBuffer* buffer = queued.buffer;
 
     for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
     {
@@ -267,18 +453,42 @@ bool MessageQueue::ProcessMessages( BufferIndex updateBufferIndex )
     buffer->Reset();
 
     // Pass back for use in the event-thread
-    mImpl->recycleQueue.push_back( buffer );
+    if( !mImpl->recycleRing.Push( buffer ) )
+    {
+      delete buffer;
+    }
+
+    if( queued.sceneUpdate )
+    {
+      ++sceneUpdates;
+    }
+
+    const Clock::duration latency = processTime - queued.flushTime;
+    mImpl->totalLatency += latency;
+    if( latency > mImpl->maxLatency )
+    {
+      mImpl->maxLatency = latency;
+    }
+    ++mImpl->processedBufferCount;
+    processed = true;
   }
 
-  mImpl->sceneUpdate >>= 1;
+  if( sceneUpdates > 0u )
+  {
+    mImpl->queuedSceneUpdates.fetch_sub( sceneUpdates, std::memory_order_relaxed );
+  }
+  mImpl->sceneUpdateProcessed = ( sceneUpdates > 0u );
 
-  mImpl->queueWasEmpty = mImpl->processQueue.empty(); // Flag whether we processed anything
+  mImpl->queueWasEmpty = !processed; // Flag whether we processed anything
 
-  mImpl->processQueue.clear();
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Flushed: %u Deferred: %u Processed: %u Latency avg: %lldus max: %lldus\n",
+                 mImpl->flushCount.load( std::memory_order_relaxed ), mImpl->deferredFlushCount.load( std::memory_order_relaxed ), mImpl->processedBufferCount,
+                 static_cast< long long >( mImpl->processedBufferCount ? std::chrono::duration_cast< std::chrono::microseconds >( mImpl->totalLatency ).count() / mImpl->processedBufferCount : 0 ),
+                 static_cast< long long >( std::chrono::duration_cast< std::chrono::microseconds >( mImpl->maxLatency ).count() ) );
 
   PERF_MONITOR_END(PerformanceMonitor::PROCESS_MESSAGES);
 
-  return ( mImpl->sceneUpdate & 0x01 ); // if it was previously 2, scene graph was updated.
+  return mImpl->sceneUpdateProcessed;
 }
 
 bool MessageQueue::WasEmpty() const
@@ -288,7 +498,9 @@ bool MessageQueue::WasEmpty() const
 
 bool MessageQueue::IsSceneUpdateRequired() const
 {
-  return mImpl->sceneUpdate;
+  // Either a flushed message requires an update, or the previous update processed one and the
+  // double-buffered values have to be synchronized
+  return mImpl->sceneUpdateProcessed || ( mImpl->queuedSceneUpdates.load( std::memory_order_relaxed ) > 0u );
 }
 
 } // namespace Update
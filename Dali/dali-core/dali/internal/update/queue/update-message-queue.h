@@ -76,6 +76,30 @@ public:
    */
   uint32_t* ReserveMessageSlot( uint32_t size, bool updateScene );
 
+  /**
+   * Reserve space for a message which sets the whole value of a property.
+   * When coalescing is enabled, a message for the same property which is waiting in the current buffer is dropped,
+   * so only the last value set before the next flush is processed.
+   * If the dropped message is the latest one in the buffer and has the same size, its space is reused.
+   * @param[in] property The property which the message sets
+   * @param[in] size the message size with respect to the size of type 'char'
+   * @param[in] updateScene If set to true, denotes that the message will cause the scene graph node tree to require an update
+   * @return A pointer to the first char allocated for the message
+   */
+  uint32_t* ReserveCoalescableMessageSlot( const void* property, uint32_t size, bool updateScene );
+
+  /**
+   * Set whether messages reserved with ReserveCoalescableMessageSlot() are coalesced.
+   * @param[in] enabled True to coalesce the messages; they are not coalesced by default
+   */
+  void SetMessageCoalescing( bool enabled );
+
+  /**
+   * Query the number of messages which have been dropped because a later message set the same property.
+   * @return The number of dropped messages since the queue was created
+   */
+  uint32_t GetCoalescedMessageCount() const;
+
   /**
    * Flushes the message queue
    * @return true if there are messages to process
@@ -25,6 +25,7 @@
 #include <dali/internal/event/common/event-thread-services.h>
 #include <dali/internal/update/common/double-buffered.h>
 #include <dali/internal/update/common/inherited-property.h>
+#include <dali/internal/update/common/scene-graph-container-index.h>
 
 namespace Dali
 {
@@ -47,7 +48,7 @@ class SceneController;
 /**
  * Scene-graph camera object
  */
-class Camera
+class Camera : public ContainerIndex
 {
 public:
   static const Dali::Camera::Type DEFAULT_TYPE;
@@ -136,6 +136,7 @@ Renderer::Renderer()
   mBlendBitmask( 0u ),
   mRegenerateUniformMap( 0u ),
   mResendFlag( 0u ),
+  mDepthIndexChanged( 0u ),
   mDepthFunction( DepthFunction::LESS ),
   mFaceCullingMode( FaceCullingMode::NONE ),
   mBlendMode( BlendMode::AUTO ),
@@ -143,6 +144,7 @@ Renderer::Renderer()
   mDepthTestMode( DepthTestMode::AUTO ),
   mRenderingBehavior( DevelRenderer::Rendering::IF_REQUIRED ),
   mPremultipledAlphaEnabled( false ),
+  mUpdated( true ),
   mOpacity( 1.0f ),
   mDepthIndex( 0 )
 {
@@ -175,6 +177,14 @@ void Renderer::operator delete( void* ptr )
 
 void Renderer::PrepareRender( BufferIndex updateBufferIndex )
 {
+  mUpdated = ( mRegenerateUniformMap != UNIFORM_MAP_READY ) || ( mResendFlag != 0 ) || ( mDepthIndexChanged != 0 );
+
+  // The render lists are double buffered, so a changed sort order has to prevent their reuse for two frames
+  if( mDepthIndexChanged > 0 )
+  {
+    --mDepthIndexChanged;
+  }
+
   if( mRegenerateUniformMap == UNIFORM_MAP_READY )
   {
     mUniformMapChanged[updateBufferIndex] = false;
@@ -345,6 +355,11 @@ void Renderer::PrepareRender( BufferIndex updateBufferIndex )
   }
 }
 
+bool Renderer::Updated() const
+{
+  return mUpdated || !mOpacity.IsClean() || IsAnyCustomPropertyDirty() || ( mShader && mShader->IsAnyCustomPropertyDirty() );
+}
+
 void Renderer::SetTextures( TextureSet* textureSet )
 {
   DALI_ASSERT_DEBUG( textureSet != NULL && "Texture set pointer is NULL" );
@@ -394,7 +409,11 @@ void Renderer::SetGeometry( Render::Geometry* geometry )
 
 void Renderer::SetDepthIndex( int depthIndex )
 {
-  mDepthIndex = depthIndex;
+  if( depthIndex != mDepthIndex )
+  {
+    mDepthIndex = depthIndex;
+    mDepthIndexChanged = 2u;
+  }
 }
 
 void Renderer::SetFaceCullingMode( FaceCullingMode::Type faceCullingMode )
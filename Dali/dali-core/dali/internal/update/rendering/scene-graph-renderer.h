@@ -26,6 +26,7 @@
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/uniform-map.h>
 #include <dali/internal/update/common/scene-graph-connection-change-propagator.h>
+#include <dali/internal/update/common/scene-graph-container-index.h>
 #include <dali/internal/update/common/animatable-property.h>
 #include <dali/internal/render/data-providers/render-data-provider.h>
 #include <dali/internal/render/renderers/render-renderer.h>
@@ -57,7 +58,8 @@ class Geometry;
 class Renderer :  public PropertyOwner,
                   public UniformMapDataProvider,
                   public UniformMap::Observer,
-                  public ConnectionChangePropagator::Observer
+                  public ConnectionChangePropagator::Observer,
+                  public ContainerIndex
 {
 public:
 
@@ -342,6 +344,13 @@ public:
    */
   void PrepareRender( BufferIndex updateBufferIndex );
 
+  /**
+   * Query whether anything affecting how this renderer looks has changed in the current frame.
+   * This is used to find the area of the surface which must be redrawn in a partial update.
+   * @return True if the renderer state, opacity or any custom property of the renderer or shader has changed.
+   */
+  bool Updated() const;
+
   /**
    * Retrieve the Render thread renderer
    * @return The associated render thread renderer
@@ -463,6 +472,7 @@ private:
   uint32_t                     mBlendBitmask;                     ///< The bitmask of blending options
   uint32_t                     mRegenerateUniformMap;             ///< 2 if the map should be regenerated, 1 if it should be copied.
   uint32_t                     mResendFlag;                       ///< Indicate whether data should be resent to the renderer
+  uint32_t                     mDepthIndexChanged;                ///< 2 if the depth index changed this frame, 1 if it changed in the previous frame
 
   DepthFunction::Type          mDepthFunction:4;                  ///< Local copy of the depth function
   FaceCullingMode::Type        mFaceCullingMode:3;                ///< Local copy of the mode of face culling
@@ -473,6 +483,7 @@ private:
 
   bool                         mUniformMapChanged[2];             ///< Records if the uniform map has been altered this frame
   bool                         mPremultipledAlphaEnabled:1;       ///< Flag indicating whether the Pre-multiplied Alpha Blending is required
+  bool                         mUpdated:1;                        ///< Records if the renderer state has been altered this frame
 
 public:
 
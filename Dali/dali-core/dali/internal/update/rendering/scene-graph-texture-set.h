@@ -22,6 +22,7 @@
 #include <dali/internal/common/buffer-index.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/event/common/event-thread-services.h>
+#include <dali/internal/update/common/scene-graph-container-index.h>
 
 namespace Dali
 {
@@ -37,7 +38,7 @@ namespace SceneGraph
 {
 class Renderer;
 
-class TextureSet
+class TextureSet : public ContainerIndex
 {
 public:
 
@@ -47,7 +48,7 @@ public:
   static TextureSet* New();
 
   /**
-   * Destructor. Not virtual as not a base class and not inheriting anything
+   * Destructor. Not virtual as not a base class
    */
   ~TextureSet();
 
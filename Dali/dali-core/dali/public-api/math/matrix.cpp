@@ -32,6 +32,14 @@
 #include <dali/public-api/math/math-utils.h>
 #include <dali/internal/render/common/performance-monitor.h>
 
+// SSE2 is always available on x86-64, and on 32-bit x86 when the compiler is asked to use it.
+// Define DALI_MATRIX_DISABLE_SIMD to fall back to the scalar implementation, e.g. for comparison.
+#if !defined( DALI_MATRIX_DISABLE_SIMD ) && !defined( __ARM_NEON__ ) && \
+    ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) )
+#define DALI_MATRIX_USE_SSE
+#include <emmintrin.h>
+#endif
+
 namespace
 {
 const float ROTATION_EPSILON = 0.003f; // Deliberately large
@@ -78,8 +86,42 @@ void Convert( float*& m, const Dali::Quaternion& rotation )
   m[14]= 0.0f;
   m[15]= 1.0f;
 }
+
+#if defined( DALI_MATRIX_USE_SSE )
+
+/**
+ * Helper to calculate a column of a matrix product, i.e. the columns of rhs weighted by the elements of a column of lhs
+ */
+inline __m128 CombineColumns( const __m128& lhsColumn, const __m128& rhs0, const __m128& rhs1, const __m128& rhs2, const __m128& rhs3 )
+{
+  __m128 result = _mm_mul_ps( _mm_shuffle_ps( lhsColumn, lhsColumn, _MM_SHUFFLE( 0, 0, 0, 0 ) ), rhs0 );
+  result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( lhsColumn, lhsColumn, _MM_SHUFFLE( 1, 1, 1, 1 ) ), rhs1 ) );
+  result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( lhsColumn, lhsColumn, _MM_SHUFFLE( 2, 2, 2, 2 ) ), rhs2 ) );
+  result = _mm_add_ps( result, _mm_mul_ps( _mm_shuffle_ps( lhsColumn, lhsColumn, _MM_SHUFFLE( 3, 3, 3, 3 ) ), rhs3 ) );
+  return result;
+}
+
+/**
+ * Helper to multiply a matrix by another held in registers
+ * All of lhs is loaded before the result is stored, so they may be the same matrix
+ */
+inline void MultiplyColumns( float* result, const float* lhsPtr, const __m128& rhs0, const __m128& rhs1, const __m128& rhs2, const __m128& rhs3 )
+{
+  const __m128 lhs0 = _mm_loadu_ps( lhsPtr );
+  const __m128 lhs1 = _mm_loadu_ps( lhsPtr + 4 );
+  const __m128 lhs2 = _mm_loadu_ps( lhsPtr + 8 );
+  const __m128 lhs3 = _mm_loadu_ps( lhsPtr + 12 );
+
+  _mm_storeu_ps( result,      CombineColumns( lhs0, rhs0, rhs1, rhs2, rhs3 ) );
+  _mm_storeu_ps( result + 4,  CombineColumns( lhs1, rhs0, rhs1, rhs2, rhs3 ) );
+  _mm_storeu_ps( result + 8,  CombineColumns( lhs2, rhs0, rhs1, rhs2, rhs3 ) );
+  _mm_storeu_ps( result + 12, CombineColumns( lhs3, rhs0, rhs1, rhs2, rhs3 ) );
 }
 
+#endif
+
+} // unnamed namespace
+
 namespace Dali
 {
 
@@ -273,7 +315,11 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Matrix& rhs )
   const float* rhsPtr  = rhs.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#ifndef  __ARM_NEON__
+#if defined( DALI_MATRIX_USE_SSE )
+
+  MultiplyColumns( temp, lhsPtr, _mm_loadu_ps( rhsPtr ), _mm_loadu_ps( rhsPtr + 4 ), _mm_loadu_ps( rhsPtr + 8 ), _mm_loadu_ps( rhsPtr + 12 ) );
+
+#elif !defined( __ARM_NEON__ )
 
   for( int32_t i=0; i < 4; i++ )
   {
@@ -359,7 +405,12 @@ void Matrix::Multiply( Matrix& result, const Matrix& lhs, const Quaternion& rhs
   float* temp = result.AsFloat();
   const float* lhsPtr = lhs.AsFloat();
 
-#ifndef  __ARM_NEON__
+#if defined( DALI_MATRIX_USE_SSE )
+
+  // The last column of the rotation matrix is (0,0,0,1), so the last element of each lhs column is passed through
+  MultiplyColumns( temp, lhsPtr, _mm_loadu_ps( rhsPtr ), _mm_loadu_ps( rhsPtr + 4 ), _mm_loadu_ps( rhsPtr + 8 ), _mm_set_ps( 1.0f, 0.0f, 0.0f, 0.0f ) );
+
+#elif !defined( __ARM_NEON__ )
 
   for( int32_t i=0; i < 4; i++ )
   {
@@ -432,7 +483,11 @@ Vector4 Matrix::operator*(const Vector4& rhs) const
 
   Vector4 temp;
 
-#ifndef  __ARM_NEON__
+#if defined( DALI_MATRIX_USE_SSE )
+
+  _mm_storeu_ps( &temp.x, CombineColumns( _mm_loadu_ps( &rhs.x ), _mm_loadu_ps( mMatrix ), _mm_loadu_ps( mMatrix + 4 ), _mm_loadu_ps( mMatrix + 8 ), _mm_loadu_ps( mMatrix + 12 ) ) );
+
+#elif !defined( __ARM_NEON__ )
 
   temp.x = rhs.x * mMatrix[0] + rhs.y * mMatrix[4] + rhs.z * mMatrix[8]  +  rhs.w * mMatrix[12];
   temp.y = rhs.x * mMatrix[1] + rhs.y * mMatrix[5] + rhs.z * mMatrix[9]  +  rhs.w * mMatrix[13];
@@ -584,6 +639,18 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     const float wz = rotation.mVector.w * rotation.mVector.z;
     const float yz = rotation.mVector.y * rotation.mVector.z;
 
+#if defined( DALI_MATRIX_USE_SSE )
+
+    // Scale whole columns and store them at once
+    const __m128 column0 = _mm_mul_ps( _mm_set_ps( 0.0f, 2.0f * ( xz - wy ), 2.0f * ( xy + wz ), 1.0f - 2.0f * ( yy + zz ) ), _mm_set1_ps( scale.x ) );
+    const __m128 column1 = _mm_mul_ps( _mm_set_ps( 0.0f, 2.0f * ( yz + wx ), 1.0f - 2.0f * ( xx + zz ), 2.0f * ( xy - wz ) ), _mm_set1_ps( scale.y ) );
+    const __m128 column2 = _mm_mul_ps( _mm_set_ps( 0.0f, 1.0f - 2.0f * ( xx + yy ), 2.0f * ( yz - wx ), 2.0f * ( xz + wy ) ), _mm_set1_ps( scale.z ) );
+    _mm_storeu_ps( mMatrix,     column0 );
+    _mm_storeu_ps( mMatrix + 4, column1 );
+    _mm_storeu_ps( mMatrix + 8, column2 );
+
+#else
+
     mMatrix[0] = (scale.x * (1.0f - 2.0f * (yy + zz)));
     mMatrix[1] = (scale.x * (       2.0f * (xy + wz)));
     mMatrix[2] = (scale.x * (       2.0f * (xz - wy)));
@@ -598,12 +665,18 @@ void Matrix::SetTransformComponents(const Vector3&    scale,
     mMatrix[9] = (scale.z * (       2.0f * (yz - wx)));
     mMatrix[10]= (scale.z * (1.0f - 2.0f * (xx + yy)));
     mMatrix[11]= 0.0f;
+
+#endif
   }
   // apply translation
+#if defined( DALI_MATRIX_USE_SSE )
+  _mm_storeu_ps( mMatrix + 12, _mm_set_ps( 1.0f, translation.z, translation.y, translation.x ) );
+#else
   mMatrix[12] = translation.x;
   mMatrix[13] = translation.y;
   mMatrix[14] = translation.z;
   mMatrix[15] = 1.0f;
+#endif
 }
 
 void Matrix::SetInverseTransformComponents(const Vector3&    scale,
@@ -726,7 +799,23 @@ void Matrix::GetTransformComponents(Vector3&     position,
   position = GetTranslation3();
 
   // Derive scale from axis lengths.
+#if defined( DALI_MATRIX_USE_SSE )
+  // Transpose the squared axes so the three lengths are calculated at once
+  __m128 xAxis = _mm_loadu_ps( mMatrix );
+  __m128 yAxis = _mm_loadu_ps( mMatrix + 4 );
+  __m128 zAxis = _mm_loadu_ps( mMatrix + 8 );
+  __m128 unused = _mm_setzero_ps();
+  xAxis = _mm_mul_ps( xAxis, xAxis );
+  yAxis = _mm_mul_ps( yAxis, yAxis );
+  zAxis = _mm_mul_ps( zAxis, zAxis );
+  _MM_TRANSPOSE4_PS( xAxis, yAxis, zAxis, unused );
+
+  float lengths[4];
+  _mm_storeu_ps( lengths, _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( xAxis, yAxis ), zAxis ) ) );
+  Vector3 theScale( lengths[0], lengths[1], lengths[2] );
+#else
   Vector3 theScale(GetXAxis().Length(), GetYAxis().Length(), GetZAxis().Length());
+#endif
   scale = theScale;
 
   if( ! ( fabs(theScale.x - Vector3::ONE.x) < ROTATION_EPSILON &&
@@ -737,8 +826,15 @@ void Matrix::GetTransformComponents(Vector3&     position,
     MATH_INCREASE_BY(PerformanceMonitor::FLOAT_POINT_MULTIPLY,9);
 
     // Non-identity scale is embedded into rotation matrix. Remove it first:
-    Matrix m(*this);
     Vector3 inverseScale(1.0f/theScale.x, 1.0f/theScale.y, 1.0f/theScale.z);
+#if defined( DALI_MATRIX_USE_SSE )
+    // Only the axes are used to find the rotation, so the translation is not copied
+    Matrix m( false );
+    _mm_storeu_ps( m.mMatrix,     _mm_mul_ps( _mm_loadu_ps( mMatrix ),     _mm_set1_ps( inverseScale.x ) ) );
+    _mm_storeu_ps( m.mMatrix + 4, _mm_mul_ps( _mm_loadu_ps( mMatrix + 4 ), _mm_set1_ps( inverseScale.y ) ) );
+    _mm_storeu_ps( m.mMatrix + 8, _mm_mul_ps( _mm_loadu_ps( mMatrix + 8 ), _mm_set1_ps( inverseScale.z ) ) );
+#else
+    Matrix m(*this);
     m.mMatrix[0] *= inverseScale.x;
     m.mMatrix[1] *= inverseScale.x;
     m.mMatrix[2] *= inverseScale.x;
@@ -748,6 +844,7 @@ void Matrix::GetTransformComponents(Vector3&     position,
     m.mMatrix[8] *= inverseScale.z;
     m.mMatrix[9] *= inverseScale.z;
     m.mMatrix[10] *= inverseScale.z;
+#endif
 
     Quaternion theRotation(m);
 
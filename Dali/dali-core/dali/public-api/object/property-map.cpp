@@ -19,10 +19,14 @@
 #include <dali/public-api/object/property-map.h>
 
 // EXTERNAL INCLUDES
+#include <cstring> // strcmp
+#include <memory>
+#include <unordered_map>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
+#include <dali/devel-api/common/hash.h>
 
 namespace Dali
 {
@@ -34,13 +38,179 @@ typedef std::vector< StringValuePair > StringValueContainer;
 typedef std::pair< Property::Index, Property::Value > IndexValuePair;
 typedef std::vector< IndexValuePair > IndexValueContainer;
 
+// Position of the first entry with a key, keyed by the hash of string keys
+typedef std::unordered_multimap< std::size_t, uint32_t > StringKeyLookup;
+typedef std::unordered_map< Property::Index, uint32_t > IndexKeyLookup;
+
+/**
+ * Maps with fewer entries than this are searched linearly; larger maps keep a hashed lookup, built as they grow.
+ */
+const std::size_t LOOKUP_THRESHOLD = 8u;
+
 }; // unnamed namespace
 
 
 struct Property::Map::Impl
 {
+  /**
+   * Find the value of the first entry with the given string key.
+   * Only reads the map, so const maps can be searched concurrently.
+   */
+  Property::Value* FindString( const char* key )
+  {
+    if( !mStringKeyLookup )
+    {
+      for( auto&& iter : mStringValueContainer )
+      {
+        if ( iter.first == key )
+        {
+          return &iter.second;
+        }
+      }
+      return NULL; // Not found
+    }
+    return FindString( key, CalculateHash( key ) );
+  }
+
+  /**
+   * Find the value of the first entry with the given index key.
+   * Only reads the map, so const maps can be searched concurrently.
+   */
+  Property::Value* FindIndex( Property::Index key )
+  {
+    if( !mIndexKeyLookup )
+    {
+      for( auto&& iter : mIndexValueContainer )
+      {
+        if ( iter.first == key )
+        {
+          return &iter.second;
+        }
+      }
+      return NULL; // Not found
+    }
+    auto iter = mIndexKeyLookup->find( key );
+    return ( iter != mIndexKeyLookup->end() ) ? &mIndexValueContainer[ iter->second ].second : NULL;
+  }
+
+  /**
+   * Append an entry with a string key.
+   */
+  Property::Value& PushBackString( std::string key, const Property::Value& value )
+  {
+    mStringValueContainer.push_back( std::make_pair( std::move( key ), value ) );
+    if( mStringKeyLookup )
+    {
+      AddStringKey( static_cast<uint32_t>( mStringValueContainer.size() - 1u ) );
+    }
+    else if( mStringValueContainer.size() == LOOKUP_THRESHOLD )
+    {
+      BuildStringKeyLookup();
+    }
+    return mStringValueContainer.back().second;
+  }
+
+  /**
+   * Append an entry with an index key.
+   */
+  Property::Value& PushBackIndex( Property::Index key, const Property::Value& value )
+  {
+    mIndexValueContainer.push_back( std::make_pair( key, value ) );
+    if( mIndexKeyLookup )
+    {
+      mIndexKeyLookup->emplace( key, static_cast<uint32_t>( mIndexValueContainer.size() - 1u ) );
+    }
+    else if( mIndexValueContainer.size() == LOOKUP_THRESHOLD )
+    {
+      BuildIndexKeyLookup();
+    }
+    return mIndexValueContainer.back().second;
+  }
+
+  /**
+   * Rebuild the lookups after the containers have been replaced.
+   */
+  void BuildLookups()
+  {
+    mStringKeysExposed = false;
+    mStringKeyLookup.reset();
+    mIndexKeyLookup.reset();
+    if( mStringValueContainer.size() >= LOOKUP_THRESHOLD )
+    {
+      BuildStringKeyLookup();
+    }
+    if( mIndexValueContainer.size() >= LOOKUP_THRESHOLD )
+    {
+      BuildIndexKeyLookup();
+    }
+  }
+
+  /**
+   * Stop using the string lookup, as any key may now be renamed through a mutable reference.
+   * The map is searched linearly until its containers are replaced.
+   */
+  void ExposeStringKeys()
+  {
+    mStringKeysExposed = true;
+    mStringKeyLookup.reset();
+  }
+
   StringValueContainer mStringValueContainer;
   IndexValueContainer mIndexValueContainer;
+  std::unique_ptr< StringKeyLookup > mStringKeyLookup; ///< Exists while the map has enough string keys and none are exposed
+  std::unique_ptr< IndexKeyLookup > mIndexKeyLookup;   ///< Exists while the map has enough index keys
+  bool mStringKeysExposed = false;                     ///< Whether GetPair() has handed out a mutable key
+
+private:
+
+  void BuildStringKeyLookup()
+  {
+    if( !mStringKeysExposed )
+    {
+      mStringKeyLookup.reset( new StringKeyLookup );
+      mStringKeyLookup->reserve( mStringValueContainer.size() );
+      for( uint32_t position = 0u, count = static_cast<uint32_t>( mStringValueContainer.size() ); position < count; ++position )
+      {
+        AddStringKey( position );
+      }
+    }
+  }
+
+  void BuildIndexKeyLookup()
+  {
+    mIndexKeyLookup.reset( new IndexKeyLookup );
+    mIndexKeyLookup->reserve( mIndexValueContainer.size() );
+    for( uint32_t position = 0u, count = static_cast<uint32_t>( mIndexValueContainer.size() ); position < count; ++position )
+    {
+      // Only the first entry with a key is found
+      mIndexKeyLookup->emplace( mIndexValueContainer[ position ].first, position );
+    }
+  }
+
+  Property::Value* FindString( const char* key, std::size_t hash )
+  {
+    auto range = mStringKeyLookup->equal_range( hash );
+    for( auto iter = range.first; iter != range.second; ++iter )
+    {
+      StringValuePair& pair = mStringValueContainer[ iter->second ];
+      if( 0 == strcmp( pair.first.c_str(), key ) )
+      {
+        return &pair.second;
+      }
+    }
+    return NULL; // Not found
+  }
+
+  void AddStringKey( uint32_t position )
+  {
+    // Only the first entry with a key is found
+    const std::string& key = mStringValueContainer[ position ].first;
+    const std::size_t hash = CalculateHash( key );
+    if( !FindString( key.c_str(), hash ) )
+    {
+      mStringKeyLookup->emplace( hash, position );
+    }
+  }
 };
 
 Property::Map::Map()
@@ -74,6 +244,7 @@ Property::Map::Map( const Property::Map& other )
 {
   mImpl->mStringValueContainer = other.mImpl->mStringValueContainer;
   mImpl->mIndexValueContainer = other.mImpl->mIndexValueContainer;
+  mImpl->BuildLookups();
 }
 
 Property::Map::Map( Property::Map&& other )
@@ -102,19 +273,19 @@ bool Property::Map::Empty() const
 void Property::Map::Insert( const char* key, const Value& value )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
-  mImpl->mStringValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->PushBackString( key, value );
 }
 
 void Property::Map::Insert( const std::string& key, const Value& value )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
-  mImpl->mStringValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->PushBackString( key, value );
 }
 
 void Property::Map::Insert( Property::Index key, const Value& value )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
-  mImpl->mIndexValueContainer.push_back( std::make_pair( key, value ) );
+  mImpl->PushBackIndex( key, value );
 }
 
 Property::Value& Property::Map::GetValue( SizeType position ) const
@@ -175,6 +346,9 @@ StringValuePair& Property::Map::GetPair( SizeType position ) const
 
   DALI_ASSERT_ALWAYS( position < ( numStringKeys ) && "position out-of-bounds" );
 
+  // The key can be changed through the returned pair at any later time
+  mImpl->ExposeStringKeys();
+
   return mImpl->mStringValueContainer[ position ];
 }
 
@@ -205,14 +379,7 @@ Property::Value* Property::Map::Find( const char* key ) const
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mStringValueContainer )
-  {
-    if ( iter.first == key )
-    {
-      return &iter.second;
-    }
-  }
-  return NULL; // Not found
+  return mImpl->FindString( key );
 }
 
 Property::Value* Property::Map::Find( const std::string& key ) const
@@ -224,14 +391,7 @@ Property::Value* Property::Map::Find( Property::Index key ) const
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mIndexValueContainer )
-  {
-    if ( iter.first == key )
-    {
-      return &iter.second;
-    }
-  }
-  return NULL; // Not found
+  return mImpl->FindIndex( key );
 }
 
 Property::Value* Property::Map::Find( Property::Index indexKey, const std::string& stringKey ) const
@@ -248,6 +408,13 @@ Property::Value* Property::Map::Find( const std::string& key, Property::Type typ
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  if( !value || ( value->GetType() == type ) )
+  {
+    return value;
+  }
+
+  // A later entry with the same key may have the requested type
   for( auto&& iter : mImpl->mStringValueContainer )
   {
     if( (iter.second.GetType() == type) && (iter.first == key) )
@@ -262,6 +429,13 @@ Property::Value* Property::Map::Find( Property::Index key, Property::Type type )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
+  Property::Value* value = mImpl->FindIndex( key );
+  if( !value || ( value->GetType() == type ) )
+  {
+    return value;
+  }
+
+  // A later entry with the same key may have the requested type
   for( auto&& iter : mImpl->mIndexValueContainer )
   {
     if( (iter.second.GetType() == type) && (iter.first == key) )
@@ -278,6 +452,7 @@ void Property::Map::Clear()
 
   mImpl->mStringValueContainer.clear();
   mImpl->mIndexValueContainer.clear();
+  mImpl->BuildLookups();
 }
 
 void Property::Map::Merge( const Property::Map& from )
@@ -311,64 +486,48 @@ const Property::Value& Property::Map::operator[]( const std::string& key ) const
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mStringValueContainer )
-  {
-    if ( iter.first == key )
-    {
-      return iter.second;
-    }
-  }
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  DALI_ASSERT_ALWAYS( value && "Invalid Key" );
 
-  DALI_ASSERT_ALWAYS( ! "Invalid Key" );
+  return *value;
 }
 
 Property::Value& Property::Map::operator[]( const std::string& key )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mStringValueContainer )
+  Property::Value* value = mImpl->FindString( key.c_str() );
+  if( value )
   {
-    if ( iter.first == key )
-    {
-      return iter.second;
-    }
+    return *value;
   }
 
   // Create and return reference to new value
-  mImpl->mStringValueContainer.push_back( std::make_pair( key, Property::Value() ) );
-  return (mImpl->mStringValueContainer.end() - 1)->second;
+  return mImpl->PushBackString( key, Property::Value() );
 }
 
 const Property::Value& Property::Map::operator[]( Property::Index key ) const
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mIndexValueContainer )
-  {
-    if ( iter.first == key )
-    {
-      return iter.second;
-    }
-  }
+  Property::Value* value = mImpl->FindIndex( key );
+  DALI_ASSERT_ALWAYS( value && "Invalid Key" );
 
-  DALI_ASSERT_ALWAYS( ! "Invalid Key" );
+  return *value;
 }
 
 Property::Value& Property::Map::operator[]( Property::Index key )
 {
   DALI_ASSERT_DEBUG( mImpl && "Cannot use an object previously used as an r-value" );
 
-  for( auto&& iter : mImpl->mIndexValueContainer )
+  Property::Value* value = mImpl->FindIndex( key );
+  if( value )
   {
-    if ( iter.first == key )
-    {
-      return iter.second;
-    }
+    return *value;
   }
 
   // Create and return reference to new value
-  mImpl->mIndexValueContainer.push_back( std::make_pair( key, Property::Value() ) );
-  return (mImpl->mIndexValueContainer.end() - 1)->second;
+  return mImpl->PushBackIndex( key, Property::Value() );
 }
 
 Property::Map& Property::Map::operator=( const Property::Map& other )
@@ -379,6 +538,7 @@ Property::Map& Property::Map::operator=( const Property::Map& other )
   {
     mImpl->mStringValueContainer = other.mImpl->mStringValueContainer;
     mImpl->mIndexValueContainer = other.mImpl->mIndexValueContainer;
+    mImpl->BuildLookups();
   }
   return *this;
 }
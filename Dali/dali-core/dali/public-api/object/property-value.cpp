@@ -19,7 +19,10 @@
 #include <dali/public-api/object/property-value.h>
 
 // EXTERNAL INCLUDES
+#include <cstring> // memcpy
+#include <new>
 #include <ostream>
+#include <utility>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/extents.h>
@@ -51,414 +54,356 @@ inline bool IsIntegerType( Property::Type type )
 }
 }
 
+/**
+ * Accessors of the storage of a Property::Value.
+ * Booleans and integers are stored as int32_t; the other inline types are stored as themselves.
+ * Allocated types store a pointer to their value. The inline types are plain data and are copied bytewise.
+ */
 struct Property::Value::Impl
 {
-  Impl( bool booleanValue )
-  : type( Property::BOOLEAN ),
-    integerValue( booleanValue )
-  { }
-
-  Impl( float floatValue )
-  : type( Property::FLOAT ),
-    floatValue( floatValue )
-  { }
-
-  Impl( int32_t integerValue )
-  : type( Property::INTEGER ),
-    integerValue( integerValue )
-  { }
-
-  Impl( const Vector2& vectorValue )
-  : type( Property::VECTOR2 ),
-    vector2Value( new Vector2( vectorValue ) )
-  { }
-
-  Impl( const Vector3& vectorValue )
-  : type( Property::VECTOR3 ),
-    vector3Value( new Vector3( vectorValue ) )
-  { }
-
-  Impl( const Vector4& vectorValue )
-  : type( Property::VECTOR4 ),
-    vector4Value( new Vector4( vectorValue ) )
-  { }
-
-  Impl( const Matrix3& matrixValue )
-  : type( Property::MATRIX3 ),
-    matrix3Value( new Matrix3( matrixValue ) )
-  {
-  }
-
-  Impl( const Matrix& matrixValue )
-  : type( Property::MATRIX ),
-    matrixValue( new Matrix( matrixValue ) )
-  {
-  }
-
-  Impl( const AngleAxis& angleAxisValue )
-  : type( Property::ROTATION ),
-    angleAxisValue( new AngleAxis(angleAxisValue) )
-  {
-  }
-
-  Impl( const Quaternion& quaternionValue )
-  : type( Property::ROTATION ),
-    angleAxisValue( new AngleAxis() )
-  {
-    quaternionValue.ToAxisAngle( angleAxisValue->axis, angleAxisValue->angle );
-  }
-
-  Impl( const std::string& stringValue )
-  : type( Property::STRING ),
-    stringValue( new std::string( stringValue ) )
+  template< typename T >
+  static void SetInline( Property::Value& value, Property::Type type, const T& data )
   {
+    static_assert( sizeof( T ) <= INLINE_STORAGE_SIZE, "Type does not fit in the inline storage" );
+    new( value.mStorage ) T( data );
+    value.mType = type;
   }
 
-  Impl( const Rect<int32_t>& rectValue )
-  : type( Property::RECTANGLE ),
-    rectValue( new Rect<int>( rectValue ) )
+  template< typename T >
+  static const T& GetInline( const Property::Value& value )
   {
+    return *reinterpret_cast< const T* >( value.mStorage );
   }
 
-  Impl( const Property::Array& arrayValue )
-  : type( Property::ARRAY ),
-    arrayValue( new Property::Array( arrayValue ) )
+  template< typename T >
+  static T& GetInline( Property::Value& value )
   {
+    return *reinterpret_cast< T* >( value.mStorage );
   }
 
-  Impl( Property::Array&& arrayValue )
-  : type( Property::ARRAY ),
-    arrayValue( new Property::Array( std::move( arrayValue ) ) )
+  template< typename T >
+  static void SetAllocated( Property::Value& value, Property::Type type, T* data )
   {
+    new( value.mStorage ) T*( data );
+    value.mType = type;
   }
 
-  Impl( const Property::Map& mapValue )
-  : type( Property::MAP ),
-    mapValue( new Property::Map( mapValue ) )
+  template< typename T >
+  static T* GetAllocated( const Property::Value& value )
   {
+    return *reinterpret_cast< T* const* >( value.mStorage );
   }
 
-  Impl( Property::Map&& mapValue )
-  : type( Property::MAP ),
-    mapValue( new Property::Map( std::move( mapValue ) ) )
-  {
-  }
-
-  Impl( const Extents& extentsValue )
-  : type( Property::EXTENTS ),
-    extentsValue( new Extents( extentsValue ) )
-  {
-  }
-
-  Impl( const std::initializer_list< KeyValuePair >& values )
-  : type( Property::MAP ),
-    mapValue( new Property::Map( values ) )
+  /**
+   * Copies an allocated type, reusing the allocation of the value if it has the same type.
+   */
+  template< typename T >
+  static void CopyAllocated( Property::Value& value, const Property::Value& other, bool sameType )
   {
+    if( sameType )
+    {
+      *GetAllocated< T >( value ) = *GetAllocated< T >( other );
+    }
+    else
+    {
+      SetAllocated( value, other.mType, new T( *GetAllocated< T >( other ) ) );
+    }
   }
 
   /**
-   * Destructor, takes care of releasing the dynamically allocated types
+   * Releases the allocated types and sets the value to empty.
    */
-  ~Impl()
+  static void Release( Property::Value& value )
   {
-    switch( type )
+    switch( value.mType )
     {
-      case Property::NONE :             // FALLTHROUGH
-      case Property::BOOLEAN :          // FALLTHROUGH
-      case Property::FLOAT :            // FALLTHROUGH
-      case Property::INTEGER :
+      case Property::MATRIX3:
       {
-        break; // nothing to do
+        delete GetAllocated< Matrix3 >( value );
+        break;
       }
-      case Property::VECTOR2 :
+      case Property::MATRIX:
       {
-        delete vector2Value;
+        delete GetAllocated< Matrix >( value );
         break;
       }
-      case Property::VECTOR3:
+      case Property::STRING:
       {
-        delete vector3Value;
+        delete GetAllocated< std::string >( value );
         break;
       }
-      case Property::VECTOR4:
+      case Property::ARRAY:
       {
-        delete vector4Value;
+        delete GetAllocated< Property::Array >( value );
         break;
       }
-      case Property::MATRIX3:
+      case Property::MAP:
       {
-        delete matrix3Value;
+        delete GetAllocated< Property::Map >( value );
         break;
       }
-      case Property::MATRIX:
+      default:
       {
-        delete matrixValue;
-        break;
+        break; // nothing to do for the inline types
       }
-      case Property::RECTANGLE:
+    }
+    value.mType = Property::NONE;
+  }
+
+  /**
+   * Exchanges the contents of two values; the allocated types only swap their pointers.
+   */
+  static void Swap( Property::Value& value, Property::Value& other )
+  {
+    uint8_t storage[ INLINE_STORAGE_SIZE ];
+    memcpy( storage, value.mStorage, INLINE_STORAGE_SIZE );
+    memcpy( value.mStorage, other.mStorage, INLINE_STORAGE_SIZE );
+    memcpy( other.mStorage, storage, INLINE_STORAGE_SIZE );
+    std::swap( value.mType, other.mType );
+  }
+
+  /**
+   * Copies another value; the value must be empty or of the same type.
+   */
+  static void Copy( Property::Value& value, const Property::Value& other )
+  {
+    const bool sameType = ( value.mType == other.mType );
+    switch( other.mType )
+    {
+      case Property::MATRIX3:
       {
-        delete rectValue;
+        CopyAllocated< Matrix3 >( value, other, sameType );
         break;
       }
-      case Property::ROTATION:
+      case Property::MATRIX:
       {
-        delete angleAxisValue;
+        CopyAllocated< Matrix >( value, other, sameType );
         break;
       }
       case Property::STRING:
       {
-        delete stringValue;
+        CopyAllocated< std::string >( value, other, sameType );
         break;
       }
       case Property::ARRAY:
       {
-        delete arrayValue;
+        CopyAllocated< Property::Array >( value, other, sameType );
         break;
       }
       case Property::MAP:
       {
-        delete mapValue;
+        CopyAllocated< Property::Map >( value, other, sameType );
         break;
       }
-      case Property::EXTENTS:
+      default:
       {
-        delete extentsValue;
+        // Inline types are plain data
+        memcpy( value.mStorage, other.mStorage, INLINE_STORAGE_SIZE );
+        value.mType = other.mType;
         break;
       }
     }
   }
-
-public: // Data
-
-  Type type;
-  union
-  {
-    int32_t integerValue;
-    float floatValue;
-    // must use pointers for any class value pre c++ 11
-    Vector2* vector2Value;
-    Vector3* vector3Value;
-    Vector4* vector4Value;
-    Matrix3* matrix3Value;
-    Matrix* matrixValue;
-    AngleAxis* angleAxisValue;
-    std::string* stringValue;
-    Rect<int32_t>* rectValue;
-    Property::Array* arrayValue;
-    Property::Map* mapValue;
-    Extents* extentsValue;
-  };
-
-private:
-
-  // non-copyable
-  Impl( const Impl& ) = delete;
-  Impl& operator=( const Impl& ) = delete;
-
 };
 
 Property::Value::Value()
-: mImpl( nullptr )
+: mType( Property::NONE )
 {
 }
 
 Property::Value::Value( bool booleanValue )
-: mImpl( new Impl( booleanValue ) )
 {
+  Impl::SetInline( *this, Property::BOOLEAN, int32_t( booleanValue ) );
 }
 
 Property::Value::Value( float floatValue )
-: mImpl( new Impl( floatValue ) )
 {
+  Impl::SetInline( *this, Property::FLOAT, floatValue );
 }
 
 Property::Value::Value( int32_t integerValue )
-: mImpl( new Impl( integerValue ) )
 {
+  Impl::SetInline( *this, Property::INTEGER, integerValue );
 }
 
 Property::Value::Value( const Vector2& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::SetInline( *this, Property::VECTOR2, vectorValue );
 }
 
 Property::Value::Value( const Vector3& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::SetInline( *this, Property::VECTOR3, vectorValue );
 }
 
 Property::Value::Value( const Vector4& vectorValue )
-: mImpl( new Impl( vectorValue ) )
 {
+  Impl::SetInline( *this, Property::VECTOR4, vectorValue );
 }
 
 Property::Value::Value( const Matrix3& matrixValue )
-: mImpl( new Impl( matrixValue ) )
 {
+  Impl::SetAllocated( *this, Property::MATRIX3, new Matrix3( matrixValue ) );
 }
 
 Property::Value::Value( const Matrix& matrixValue )
-: mImpl( new Impl( matrixValue ) )
 {
+  Impl::SetAllocated( *this, Property::MATRIX, new Matrix( matrixValue ) );
 }
 
 Property::Value::Value( const Rect<int32_t>& rectValue )
-: mImpl( new Impl( rectValue ) )
 {
+  Impl::SetInline( *this, Property::RECTANGLE, rectValue );
 }
 
 Property::Value::Value( const AngleAxis& angleAxisValue )
-: mImpl( new Impl( angleAxisValue ) )
 {
+  Impl::SetInline( *this, Property::ROTATION, angleAxisValue );
 }
 
 Property::Value::Value( const Quaternion& quaternionValue )
-: mImpl( new Impl( quaternionValue ) )
 {
+  AngleAxis angleAxis;
+  quaternionValue.ToAxisAngle( angleAxis.axis, angleAxis.angle );
+  Impl::SetInline( *this, Property::ROTATION, angleAxis );
 }
 
 Property::Value::Value( const std::string& stringValue )
-: mImpl( new Impl( stringValue ) )
 {
+  Impl::SetAllocated( *this, Property::STRING, new std::string( stringValue ) );
 }
 
 Property::Value::Value( const char* stringValue )
-: mImpl( nullptr )
 {
-  if( stringValue ) // string constructor is undefined with nullptr
-  {
-    mImpl = new Impl( std::string(stringValue) );
-  }
-  else
-  {
-    mImpl = new Impl( std::string() );
-  }
+  // string constructor is undefined with nullptr
+  Impl::SetAllocated( *this, Property::STRING, stringValue ? new std::string( stringValue ) : new std::string() );
 }
 
 Property::Value::Value( Property::Array& arrayValue )
-: mImpl( new Impl( arrayValue ) )
 {
+  Impl::SetAllocated( *this, Property::ARRAY, new Property::Array( arrayValue ) );
 }
 
 Property::Value::Value( Property::Array&& arrayValue )
-: mImpl( new Impl( std::move( arrayValue ) ) )
 {
+  Impl::SetAllocated( *this, Property::ARRAY, new Property::Array( std::move( arrayValue ) ) );
 }
 
 Property::Value::Value( Property::Map& mapValue )
-: mImpl( new Impl( mapValue ) )
 {
+  Impl::SetAllocated( *this, Property::MAP, new Property::Map( mapValue ) );
 }
 
 Property::Value::Value( Property::Map&& mapValue )
-: mImpl( new Impl( std::move( mapValue ) ) )
 {
+  Impl::SetAllocated( *this, Property::MAP, new Property::Map( std::move( mapValue ) ) );
 }
 
 Property::Value::Value( const Extents& extentsValue )
-: mImpl( new Impl( extentsValue ) )
 {
+  Impl::SetInline( *this, Property::EXTENTS, extentsValue );
 }
 
 Property::Value::Value( const std::initializer_list< KeyValuePair >& values )
-: mImpl( new Impl( values ) )
 {
+  Impl::SetAllocated( *this, Property::MAP, new Property::Map( values ) );
 }
 
 Property::Value::Value( Type type )
-: mImpl( nullptr )
+: mType( Property::NONE )
 {
   switch (type)
   {
     case Property::BOOLEAN:
     {
-      mImpl = new Impl( false );
+      Impl::SetInline( *this, type, int32_t( 0 ) );
       break;
     }
     case Property::FLOAT:
     {
-      mImpl = new Impl( 0.f );
+      Impl::SetInline( *this, type, 0.f );
       break;
     }
     case Property::INTEGER:
     {
-      mImpl = new Impl( 0 );
+      Impl::SetInline( *this, type, int32_t( 0 ) );
       break;
     }
     case Property::VECTOR2:
     {
-      mImpl = new Impl( Vector2::ZERO );
+      Impl::SetInline( *this, type, Vector2::ZERO );
       break;
     }
     case Property::VECTOR3:
     {
-      mImpl = new Impl( Vector3::ZERO );
+      Impl::SetInline( *this, type, Vector3::ZERO );
       break;
     }
     case Property::VECTOR4:
     {
-      mImpl = new Impl( Vector4::ZERO );
+      Impl::SetInline( *this, type, Vector4::ZERO );
       break;
     }
     case Property::RECTANGLE:
     {
-      mImpl = new Impl( Rect<int32_t>(0,0,0,0) );
+      Impl::SetInline( *this, type, Rect<int32_t>(0,0,0,0) );
       break;
     }
     case Property::ROTATION:
     {
-      mImpl = new Impl( AngleAxis() );
+      Impl::SetInline( *this, type, AngleAxis() );
       break;
     }
     case Property::STRING:
     {
-      mImpl = new Impl( std::string() );
+      Impl::SetAllocated( *this, type, new std::string() );
       break;
     }
     case Property::MATRIX:
     {
-      mImpl = new Impl( Matrix() );
+      Impl::SetAllocated( *this, type, new Matrix() );
       break;
     }
     case Property::MATRIX3:
     {
-      mImpl = new Impl( Matrix3() );
+      Impl::SetAllocated( *this, type, new Matrix3() );
       break;
     }
     case Property::ARRAY:
     {
-      mImpl = new Impl( Property::Array() );
+      Impl::SetAllocated( *this, type, new Property::Array() );
       break;
     }
     case Property::MAP:
     {
-      mImpl = new Impl( Property::Map() );
+      Impl::SetAllocated( *this, type, new Property::Map() );
       break;
     }
     case Property::EXTENTS:
     {
-      mImpl = new Impl( Extents() );
+      Impl::SetInline( *this, type, Extents() );
       break;
     }
     case Property::NONE:
     {
-      // No need to create an Impl
+      // Nothing to store
       break;
     }
   }
 }
 
 Property::Value::Value( const Property::Value& value )
-: mImpl( nullptr )
+: mType( Property::NONE )
 {
-  // reuse assignment operator
-  operator=( value );
+  Impl::Copy( *this, value );
 }
 
 Property::Value::Value( Property::Value&& value )
-: mImpl( value.mImpl )
+: mType( value.mType )
 {
-  value.mImpl = nullptr;
+  // Inline types are copied bytewise and the allocated types only store a pointer
+  memcpy( mStorage, value.mStorage, INLINE_STORAGE_SIZE );
+  value.mType = Property::NONE;
 }
 
 Property::Value& Property::Value::operator=( const Property::Value& value )
@@ -468,175 +413,17 @@ Property::Value& Property::Value::operator=( const Property::Value& value )
     // skip self assignment
     return *this;
   }
-  // if we are assigned an empty value, just drop impl
-  if( !value.mImpl )
+
+  if( ( mType == value.mType ) && ( mType != Property::ARRAY ) && ( mType != Property::MAP ) )
   {
-    delete mImpl;
-    mImpl = nullptr;
-    return *this;
-  }
-  // first check if the type is the same, no need to change impl, just assign
-  if( mImpl && ( mImpl->type == value.mImpl->type ) )
-  {
-    switch( mImpl->type )
-    {
-      case Property::BOOLEAN:
-      {
-        mImpl->integerValue = value.mImpl->integerValue;
-        break;
-      }
-      case Property::FLOAT:
-      {
-        mImpl->floatValue = value.mImpl->floatValue;
-        break;
-      }
-      case Property::INTEGER:
-      {
-        mImpl->integerValue = value.mImpl->integerValue;
-        break;
-      }
-      case Property::VECTOR2:
-      {
-        *mImpl->vector2Value = *value.mImpl->vector2Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR3:
-      {
-        *mImpl->vector3Value = *value.mImpl->vector3Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR4:
-      {
-        *mImpl->vector4Value = *value.mImpl->vector4Value; // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::RECTANGLE:
-      {
-        *mImpl->rectValue = *value.mImpl->rectValue; // type cannot change in mImpl so rect is allocated
-        break;
-      }
-      case Property::ROTATION:
-      {
-        *mImpl->angleAxisValue = *value.mImpl->angleAxisValue; // type cannot change in mImpl so quaternion is allocated
-        break;
-      }
-      case Property::STRING:
-      {
-        *mImpl->stringValue = *value.mImpl->stringValue; // type cannot change in mImpl so string is allocated
-        break;
-      }
-      case Property::MATRIX:
-      {
-        *mImpl->matrixValue = *value.mImpl->matrixValue; // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::MATRIX3:
-      {
-        *mImpl->matrix3Value = *value.mImpl->matrix3Value; // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::ARRAY:
-      {
-        *mImpl->arrayValue = *value.mImpl->arrayValue; // type cannot change in mImpl so array is allocated
-        break;
-      }
-      case Property::MAP:
-      {
-        *mImpl->mapValue = *value.mImpl->mapValue; // type cannot change in mImpl so map is allocated
-        break;
-      }
-      case Property::EXTENTS:
-      {
-        *mImpl->extentsValue = *value.mImpl->extentsValue; // type cannot change in mImpl so extents is allocated
-        break;
-      }
-      case Property::NONE:
-      { // mImpl will be a nullptr, there's no way to get to this case
-      }
-    }
+    // The type is the same, so the allocated types can be assigned without a new allocation
+    Impl::Copy( *this, value );
   }
   else
   {
-    // different type, release old impl and create new
-    Impl* newImpl( nullptr );
-    switch ( value.mImpl->type )
-    {
-      case Property::BOOLEAN:
-      {
-        newImpl = new Impl( bool( value.mImpl->integerValue ) );
-        break;
-      }
-      case Property::FLOAT:
-      {
-        newImpl = new Impl( value.mImpl->floatValue );
-        break;
-      }
-      case Property::INTEGER:
-      {
-        newImpl = new Impl( value.mImpl->integerValue );
-        break;
-      }
-      case Property::VECTOR2:
-      {
-        newImpl = new Impl( *value.mImpl->vector2Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR3:
-      {
-        newImpl = new Impl( *value.mImpl->vector3Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::VECTOR4:
-      {
-        newImpl = new Impl( *value.mImpl->vector4Value ); // type cannot change in mImpl so vector is allocated
-        break;
-      }
-      case Property::RECTANGLE:
-      {
-        newImpl = new Impl( *value.mImpl->rectValue ); // type cannot change in mImpl so rect is allocated
-        break;
-      }
-      case Property::ROTATION:
-      {
-        newImpl = new Impl( *value.mImpl->angleAxisValue ); // type cannot change in mImpl so quaternion is allocated
-        break;
-      }
-      case Property::MATRIX3:
-      {
-        newImpl = new Impl( *value.mImpl->matrix3Value ); // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::MATRIX:
-      {
-        newImpl = new Impl( *value.mImpl->matrixValue ); // type cannot change in mImpl so matrix is allocated
-        break;
-      }
-      case Property::STRING:
-      {
-        newImpl = new Impl( *value.mImpl->stringValue ); // type cannot change in mImpl so string is allocated
-        break;
-      }
-      case Property::ARRAY:
-      {
-        newImpl = new Impl( *value.mImpl->arrayValue ); // type cannot change in mImpl so array is allocated
-        break;
-      }
-      case Property::MAP:
-      {
-        newImpl = new Impl( *value.mImpl->mapValue ); // type cannot change in mImpl so map is allocated
-        break;
-      }
-      case Property::EXTENTS:
-      {
-        newImpl = new Impl( *value.mImpl->extentsValue ); // type cannot change in mImpl so extents is allocated
-        break;
-      }
-      case Property::NONE:
-      { // nullptr value will be used for "empty" value
-      }
-    }
-    delete mImpl;
-    mImpl = newImpl;
+    // The value may be inside an array or a map of this one; it is copied before the old contents are released
+    Property::Value copy( value );
+    Impl::Swap( *this, copy );
   }
 
   return *this;
@@ -646,9 +433,9 @@ Property::Value& Property::Value::operator=( Property::Value&& value )
 {
   if( this != &value )
   {
-    delete mImpl;
-    mImpl = value.mImpl;
-    value.mImpl = nullptr;
+    // The value may be inside an array or a map of this one; it is moved out before the old contents are released
+    Property::Value moved( std::move( value ) );
+    Impl::Swap( *this, moved );
   }
 
   return *this;
@@ -656,25 +443,20 @@ Property::Value& Property::Value::operator=( Property::Value&& value )
 
 Property::Value::~Value()
 {
-  delete mImpl;
+  Impl::Release( *this );
 }
 
 Property::Type Property::Value::GetType() const
 {
-  Property::Type type( Property::NONE );
-  if( mImpl )
-  {
-    type = mImpl->type;
-  }
-  return type;
+  return mType;
 }
 
 bool Property::Value::Get( bool& booleanValue ) const
 {
   bool converted = false;
-  if( mImpl && IsIntegerType( mImpl->type ) )
+  if( IsIntegerType( mType ) )
   {
-    booleanValue = mImpl->integerValue;
+    booleanValue = Impl::GetInline< int32_t >( *this );
     converted = true;
   }
   return converted;
@@ -683,18 +465,15 @@ bool Property::Value::Get( bool& booleanValue ) const
 bool Property::Value::Get( float& floatValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == FLOAT )
   {
-    if( mImpl->type == FLOAT )
-    {
-      floatValue = mImpl->floatValue;
-      converted = true;
-    }
-    else if( IsIntegerType( mImpl->type ) )
-    {
-      floatValue = static_cast< float >( mImpl->integerValue );
-      converted = true;
-    }
+    floatValue = Impl::GetInline< float >( *this );
+    converted = true;
+  }
+  else if( IsIntegerType( mType ) )
+  {
+    floatValue = static_cast< float >( Impl::GetInline< int32_t >( *this ) );
+    converted = true;
   }
   return converted;
 }
@@ -702,18 +481,15 @@ bool Property::Value::Get( float& floatValue ) const
 bool Property::Value::Get( int32_t& integerValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( IsIntegerType( mType ) )
   {
-    if( IsIntegerType( mImpl->type ) )
-    {
-      integerValue = mImpl->integerValue;
-      converted = true;
-    }
-    else if( mImpl->type == FLOAT )
-    {
-      integerValue = static_cast< int32_t >( mImpl->floatValue );
-      converted = true;
-    }
+    integerValue = Impl::GetInline< int32_t >( *this );
+    converted = true;
+  }
+  else if( mType == FLOAT )
+  {
+    integerValue = static_cast< int32_t >( Impl::GetInline< float >( *this ) );
+    converted = true;
   }
   return converted;
 }
@@ -721,14 +497,10 @@ bool Property::Value::Get( int32_t& integerValue ) const
 bool Property::Value::Get( Vector2& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == VECTOR2 || mType == VECTOR3 || mType == VECTOR4 )
   {
-    // type cannot change in mImpl so vector is allocated
-    if( mImpl->type == VECTOR2 || mImpl->type == VECTOR3 || mImpl->type == VECTOR4 )
-    {
-      vectorValue = *(mImpl->vector2Value); // if Vector3 or 4 only x and y are assigned
-      converted = true;
-    }
+    vectorValue = Impl::GetInline< Vector2 >( *this ); // if Vector3 or 4 only x and y are assigned
+    converted = true;
   }
   return converted;
 }
@@ -736,19 +508,15 @@ bool Property::Value::Get( Vector2& vectorValue ) const
 bool Property::Value::Get( Vector3& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if ( mType == VECTOR3 || mType == VECTOR4 )
   {
-    // type cannot change in mImpl so vector is allocated
-    if ( mImpl->type == VECTOR3 || mImpl->type == VECTOR4 )
-    {
-      vectorValue = *(mImpl->vector3Value); // if Vector4 only x,y,z are assigned
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR2 )
-    {
-      vectorValue = *(mImpl->vector2Value);
-      converted = true;
-    }
+    vectorValue = Impl::GetInline< Vector3 >( *this ); // if Vector4 only x,y,z are assigned
+    converted = true;
+  }
+  else if( mType == VECTOR2 )
+  {
+    vectorValue = Impl::GetInline< Vector2 >( *this );
+    converted = true;
   }
   return converted;
 }
@@ -756,23 +524,20 @@ bool Property::Value::Get( Vector3& vectorValue ) const
 bool Property::Value::Get( Vector4& vectorValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == VECTOR4 )
   {
-    if( mImpl->type == VECTOR4 ) // type cannot change in mImpl so vector is allocated
-    {
-      vectorValue = *(mImpl->vector4Value);
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR2 )
-    {
-      vectorValue = *(mImpl->vector2Value);
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR3 )
-    {
-      vectorValue = *(mImpl->vector3Value);
-      converted = true;
-    }
+    vectorValue = Impl::GetInline< Vector4 >( *this );
+    converted = true;
+  }
+  else if( mType == VECTOR2 )
+  {
+    vectorValue = Impl::GetInline< Vector2 >( *this );
+    converted = true;
+  }
+  else if( mType == VECTOR3 )
+  {
+    vectorValue = Impl::GetInline< Vector3 >( *this );
+    converted = true;
   }
   return converted;
 }
@@ -780,9 +545,9 @@ bool Property::Value::Get( Vector4& vectorValue ) const
 bool Property::Value::Get( Matrix3& matrixValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MATRIX3) ) // type cannot change in mImpl so matrix is allocated
+  if( mType == MATRIX3 )
   {
-    matrixValue = *(mImpl->matrix3Value);
+    matrixValue = *Impl::GetAllocated< Matrix3 >( *this );
     converted = true;
   }
   return converted;
@@ -791,9 +556,9 @@ bool Property::Value::Get( Matrix3& matrixValue ) const
 bool Property::Value::Get( Matrix& matrixValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MATRIX) ) // type cannot change in mImpl so matrix is allocated
+  if( mType == MATRIX )
   {
-    matrixValue = *(mImpl->matrixValue);
+    matrixValue = *Impl::GetAllocated< Matrix >( *this );
     converted = true;
   }
   return converted;
@@ -802,9 +567,9 @@ bool Property::Value::Get( Matrix& matrixValue ) const
 bool Property::Value::Get( Rect<int32_t>& rectValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == RECTANGLE) ) // type cannot change in mImpl so rect is allocated
+  if( mType == RECTANGLE )
   {
-    rectValue = *(mImpl->rectValue);
+    rectValue = Impl::GetInline< Rect<int32_t> >( *this );
     converted = true;
   }
   return converted;
@@ -813,9 +578,9 @@ bool Property::Value::Get( Rect<int32_t>& rectValue ) const
 bool Property::Value::Get( AngleAxis& angleAxisValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ROTATION) ) // type cannot change in mImpl so angleAxis is allocated
+  if( mType == ROTATION )
   {
-    angleAxisValue = *(mImpl->angleAxisValue);
+    angleAxisValue = Impl::GetInline< AngleAxis >( *this );
     converted = true;
   }
   return converted;
@@ -824,9 +589,10 @@ bool Property::Value::Get( AngleAxis& angleAxisValue ) const
 bool Property::Value::Get( Quaternion& quaternionValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ROTATION) ) // type cannot change in mImpl so angleAxis is allocated
+  if( mType == ROTATION )
   {
-    quaternionValue = Quaternion(mImpl->angleAxisValue->angle, mImpl->angleAxisValue->axis );
+    const AngleAxis& angleAxis = Impl::GetInline< AngleAxis >( *this );
+    quaternionValue = Quaternion( angleAxis.angle, angleAxis.axis );
     converted = true;
   }
   return converted;
@@ -835,9 +601,9 @@ bool Property::Value::Get( Quaternion& quaternionValue ) const
 bool Property::Value::Get( std::string& stringValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == STRING) ) // type cannot change in mImpl so string is allocated
+  if( mType == STRING )
   {
-    stringValue.assign( *(mImpl->stringValue) );
+    stringValue.assign( *Impl::GetAllocated< std::string >( *this ) );
     converted = true;
   }
   return converted;
@@ -846,9 +612,9 @@ bool Property::Value::Get( std::string& stringValue ) const
 bool Property::Value::Get( Property::Array& arrayValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == ARRAY) ) // type cannot change in mImpl so array is allocated
+  if( mType == ARRAY )
   {
-    arrayValue = *(mImpl->arrayValue);
+    arrayValue = *Impl::GetAllocated< Property::Array >( *this );
     converted = true;
   }
   return converted;
@@ -857,9 +623,9 @@ bool Property::Value::Get( Property::Array& arrayValue ) const
 bool Property::Value::Get( Property::Map& mapValue ) const
 {
   bool converted = false;
-  if( mImpl && (mImpl->type == MAP) ) // type cannot change in mImpl so map is allocated
+  if( mType == MAP )
   {
-    mapValue = *(mImpl->mapValue);
+    mapValue = *Impl::GetAllocated< Property::Map >( *this );
     converted = true;
   }
   return converted;
@@ -868,9 +634,9 @@ bool Property::Value::Get( Property::Map& mapValue ) const
 Property::Array* Property::Value::GetArray() const
 {
   Property::Array* array = nullptr;
-  if( mImpl && (mImpl->type == ARRAY) ) // type cannot change in mImpl so array is allocated
+  if( mType == ARRAY )
   {
-    array = mImpl->arrayValue;
+    array = Impl::GetAllocated< Property::Array >( *this );
   }
   return array;
 }
@@ -878,9 +644,9 @@ Property::Array* Property::Value::GetArray() const
 Property::Map* Property::Value::GetMap() const
 {
   Property::Map* map = nullptr;
-  if( mImpl && (mImpl->type == MAP) ) // type cannot change in mImpl so map is allocated
+  if( mType == MAP )
   {
-    map = mImpl->mapValue;
+    map = Impl::GetAllocated< Property::Map >( *this );
   }
   return map;
 }
@@ -888,111 +654,104 @@ Property::Map* Property::Value::GetMap() const
 bool Property::Value::Get( Extents& extentsValue ) const
 {
   bool converted = false;
-  if( mImpl )
+  if( mType == EXTENTS )
   {
-    if( mImpl->type == EXTENTS )
-    {
-      extentsValue = *(mImpl->extentsValue);
-      converted = true;
-    }
-    else if( mImpl->type == VECTOR4 )
-    {
-      extentsValue.start = static_cast< uint16_t >( mImpl->vector4Value->x );
-      extentsValue.end = static_cast< uint16_t >( mImpl->vector4Value->y );
-      extentsValue.top = static_cast< uint16_t >( mImpl->vector4Value->z );
-      extentsValue.bottom = static_cast< uint16_t >( mImpl->vector4Value->w );
-      converted = true;
-    }
+    extentsValue = Impl::GetInline< Extents >( *this );
+    converted = true;
+  }
+  else if( mType == VECTOR4 )
+  {
+    const Vector4& vector4Value = Impl::GetInline< Vector4 >( *this );
+    extentsValue.start = static_cast< uint16_t >( vector4Value.x );
+    extentsValue.end = static_cast< uint16_t >( vector4Value.y );
+    extentsValue.top = static_cast< uint16_t >( vector4Value.z );
+    extentsValue.bottom = static_cast< uint16_t >( vector4Value.w );
+    converted = true;
   }
   return converted;
 }
 
 std::ostream& operator<<( std::ostream& stream, const Property::Value& value )
 {
-  if( value.mImpl )
-  {
-    const Property::Value::Impl& impl( *value.mImpl );
+  typedef Property::Value::Impl Impl;
 
-    switch( impl.type )
+  switch( value.mType )
+  {
+    case Dali::Property::BOOLEAN:
     {
-      case Dali::Property::BOOLEAN:
-      {
-        stream << impl.integerValue;
-        break;
-      }
-      case Dali::Property::FLOAT:
-      {
-        stream << impl.floatValue;
-        break;
-      }
-      case Dali::Property::INTEGER:
-      {
-         stream << impl.integerValue;
-         break;
-      }
-      case Dali::Property::VECTOR2:
-      {
-        stream << *impl.vector2Value;
-        break;
-      }
-      case Dali::Property::VECTOR3:
-      {
-        stream << *impl.vector3Value;
-        break;
-      }
-      case Dali::Property::VECTOR4:
-      {
-        stream << *impl.vector4Value;
-        break;
-      }
-      case Dali::Property::MATRIX3:
-      {
-        stream << *impl.matrix3Value;
-        break;
-      }
-      case Dali::Property::MATRIX:
-      {
-        stream << *impl.matrixValue;
-        break;
-      }
-      case Dali::Property::RECTANGLE:
-      {
-        stream << *impl.rectValue;
-        break;
-      }
-      case Dali::Property::ROTATION:
-      {
-        stream << *impl.angleAxisValue;
-        break;
-      }
-      case Dali::Property::STRING:
-      {
-        stream << *impl.stringValue;
-        break;
-      }
-      case Dali::Property::ARRAY:
-      {
-        stream << *(value.GetArray());
-        break;
-      }
-      case Dali::Property::MAP:
-      {
-        stream << *(value.GetMap());
-        break;
-      }
-      case Dali::Property::EXTENTS:
-      {
-        stream << *impl.extentsValue;
-        break;
-      }
-      case Dali::Property::NONE:
-      { // mImpl will be a nullptr, there's no way to get to this case
-      }
+      stream << Impl::GetInline< int32_t >( value );
+      break;
+    }
+    case Dali::Property::FLOAT:
+    {
+      stream << Impl::GetInline< float >( value );
+      break;
+    }
+    case Dali::Property::INTEGER:
+    {
+       stream << Impl::GetInline< int32_t >( value );
+       break;
+    }
+    case Dali::Property::VECTOR2:
+    {
+      stream << Impl::GetInline< Vector2 >( value );
+      break;
+    }
+    case Dali::Property::VECTOR3:
+    {
+      stream << Impl::GetInline< Vector3 >( value );
+      break;
+    }
+    case Dali::Property::VECTOR4:
+    {
+      stream << Impl::GetInline< Vector4 >( value );
+      break;
+    }
+    case Dali::Property::MATRIX3:
+    {
+      stream << *Impl::GetAllocated< Matrix3 >( value );
+      break;
+    }
+    case Dali::Property::MATRIX:
+    {
+      stream << *Impl::GetAllocated< Matrix >( value );
+      break;
+    }
+    case Dali::Property::RECTANGLE:
+    {
+      stream << Impl::GetInline< Rect<int32_t> >( value );
+      break;
+    }
+    case Dali::Property::ROTATION:
+    {
+      stream << Impl::GetInline< AngleAxis >( value );
+      break;
+    }
+    case Dali::Property::STRING:
+    {
+      stream << *Impl::GetAllocated< std::string >( value );
+      break;
+    }
+    case Dali::Property::ARRAY:
+    {
+      stream << *(value.GetArray());
+      break;
+    }
+    case Dali::Property::MAP:
+    {
+      stream << *(value.GetMap());
+      break;
+    }
+    case Dali::Property::EXTENTS:
+    {
+      stream << Impl::GetInline< Extents >( value );
+      break;
+    }
+    case Dali::Property::NONE:
+    {
+      stream << "undefined type";
+      break;
     }
-  }
-  else
-  {
-    stream << "undefined type";
   }
   return stream;
 }
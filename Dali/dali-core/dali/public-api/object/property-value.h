@@ -512,8 +512,23 @@ public:
 
 private:
 
+  /**
+   * @brief Size of the inline storage; large enough for a Vector4, a Rect<int32_t> or an AngleAxis.
+   */
+  static const uint32_t INLINE_STORAGE_SIZE = 16u;
+
   struct DALI_INTERNAL Impl;
-  Impl* mImpl; ///< Pointer to the implementation
+
+  /**
+   * Scalar, vector, rectangle, rotation and extents values are stored inline.
+   * Strings, arrays, maps and matrices are allocated and a pointer to them is stored.
+   */
+  union
+  {
+    uint8_t mStorage[ INLINE_STORAGE_SIZE ]; ///< The value or a pointer to it
+    void* mAlignment;                        ///< Aligns the storage for the allocated types
+  };
+  Type mType; ///< The type of the stored value
 
 };
 
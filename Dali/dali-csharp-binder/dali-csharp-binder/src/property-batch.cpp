@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef CSHARP_PROPERTY_BATCH
+#define CSHARP_PROPERTY_BATCH
+#endif
+
+#include "common.h"
+#include <dali/public-api/object/handle.h>
+
+namespace
+{
+
+/**
+ * A single property set, as packed by the C# side.
+ * The layout is blittable: C# declares the same fields with StructLayout.Sequential,
+ * using an IntPtr for the handle (the swigCPtr of the object) and the Property.Type value as the type.
+ */
+struct PropertyBatchRecord
+{
+  void* handle;          ///< The Dali::Handle to set the property on
+  int32_t index;         ///< The index of the property
+  int32_t type;          ///< The Dali::Property::Type of the payload
+  union
+  {
+    float floatValues[4]; ///< FLOAT, VECTOR2, VECTOR3 and VECTOR4 payloads
+    int32_t integerValue; ///< INTEGER and BOOLEAN payloads
+  };
+};
+
+/**
+ * Sets the property of a record. The supported types are stored inline in a Property::Value,
+ * so no memory is allocated.
+ * @return false if the type of the record is not supported
+ */
+inline bool SetRecordProperty( Dali::Handle& handle, const PropertyBatchRecord& record )
+{
+  switch( record.type )
+  {
+    case Dali::Property::FLOAT:
+    {
+      handle.SetProperty( record.index, record.floatValues[0] );
+      break;
+    }
+    case Dali::Property::VECTOR2:
+    {
+      handle.SetProperty( record.index, Dali::Vector2( record.floatValues ) );
+      break;
+    }
+    case Dali::Property::VECTOR3:
+    {
+      handle.SetProperty( record.index, Dali::Vector3( record.floatValues ) );
+      break;
+    }
+    case Dali::Property::VECTOR4:
+    {
+      handle.SetProperty( record.index, Dali::Vector4( record.floatValues ) );
+      break;
+    }
+    case Dali::Property::INTEGER:
+    {
+      handle.SetProperty( record.index, record.integerValue );
+      break;
+    }
+    case Dali::Property::BOOLEAN:
+    {
+      handle.SetProperty( record.index, record.integerValue != 0 );
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Writes a float, Vector2, Vector3 or Vector4 property value into a float buffer.
+ * @param[in] value The property value
+ * @param[out] out The buffer, which has room for components floats
+ * @param[in] components The number of floats to write, 1 to 4
+ * @return false if the value cannot be converted to the requested number of floats
+ */
+inline bool GetValueFloats( const Dali::Property::Value& value, float* out, unsigned int components )
+{
+  bool converted = false;
+  switch( components )
+  {
+    case 1:
+    {
+      converted = value.Get( out[0] );
+      break;
+    }
+    case 2:
+    {
+      Dali::Vector2 vector;
+      converted = value.Get( vector );
+      out[0] = vector.x;
+      out[1] = vector.y;
+      break;
+    }
+    case 3:
+    {
+      Dali::Vector3 vector;
+      converted = value.Get( vector );
+      out[0] = vector.x;
+      out[1] = vector.y;
+      out[2] = vector.z;
+      break;
+    }
+    case 4:
+    {
+      Dali::Vector4 vector;
+      converted = value.Get( vector );
+      out[0] = vector.x;
+      out[1] = vector.y;
+      out[2] = vector.z;
+      out[3] = vector.w;
+      break;
+    }
+  }
+  return converted;
+}
+
+/**
+ * Reads a property of a number of handles into a float buffer.
+ * The property values are stored inline in a Property::Value, so no memory is allocated.
+ * @param[in] handles The handles
+ * @param[in] count The number of handles
+ * @param[in] index The index of the property
+ * @param[out] out The buffer, which has room for count * components floats
+ * @param[in] components The number of floats per handle, 1 to 4
+ * @param[in] current Whether to read the current (scene-graph) value rather than the event-side value
+ * @return true if the property of every handle was converted
+ */
+bool GetPropertyFloats( Dali::Handle* const* handles, unsigned int count, int index, float* out, unsigned int components, bool current )
+{
+  if (!handles || !out) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "Handle or float buffer is null", 0);
+    return false;
+  }
+  if (components < 1 || components > 4) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentOutOfRangeException, "Number of components must be 1 to 4", 0);
+    return false;
+  }
+
+  bool result = true;
+  {
+    try {
+      for( unsigned int i = 0; i < count; ++i ) {
+        Dali::Handle *handle = handles[i];
+        if (!handle) {
+          SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "Dali::Handle is null", 0);
+          return false;
+        }
+        const Dali::Property::Value value = current ? handle->GetCurrentProperty(index) : handle->GetProperty(index);
+        result = GetValueFloats(value, out + i * components, components) && result;
+      }
+    } catch (std::out_of_range& e) {
+      {
+        SWIG_CSharpException(SWIG_IndexError, const_cast<char*>(e.what())); return false;
+      };
+    } catch (std::exception& e) {
+      {
+        SWIG_CSharpException(SWIG_RuntimeError, const_cast<char*>(e.what())); return false;
+      };
+    } catch (Dali::DaliException e) {
+      {
+        SWIG_CSharpException(SWIG_UnknownError, e.condition); return false;
+      };
+    } catch (...) {
+      {
+        SWIG_CSharpException(SWIG_UnknownError, "unknown error"); return false;
+      };
+    }
+  }
+
+  return result;
+}
+
+} // unnamed namespace
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Applies a buffer of property sets in one call.
+ * Processing stops at the first invalid record, and a pending exception is raised for it.
+ * @param[in] jarg1 The PropertyBatchRecord buffer
+ * @param[in] jarg2 The number of records in the buffer
+ * @return The number of records applied
+ */
+SWIGEXPORT unsigned int SWIGSTDCALL CSharp_Dali_Handle_SetProperties(void * jarg1, unsigned int jarg2) {
+  const PropertyBatchRecord *records = (const PropertyBatchRecord *)jarg1;
+  unsigned int count = jarg2;
+  unsigned int applied = 0;
+
+  if (!records && count > 0) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "PropertyBatchRecord buffer is null", 0);
+    return 0;
+  }
+  {
+    try {
+      for( ; applied < count; ++applied ) {
+        const PropertyBatchRecord& record = records[applied];
+        Dali::Handle *handle = (Dali::Handle *)record.handle;
+        if (!handle) {
+          SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "Dali::Handle of a property record is null", 0);
+          return applied;
+        }
+        if (!SetRecordProperty(*handle, record)) {
+          SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentOutOfRangeException, "Unsupported type of a property record", 0);
+          return applied;
+        }
+      }
+    } catch (std::out_of_range& e) {
+      {
+        SWIG_CSharpException(SWIG_IndexError, const_cast<char*>(e.what())); return applied;
+      };
+    } catch (std::exception& e) {
+      {
+        SWIG_CSharpException(SWIG_RuntimeError, const_cast<char*>(e.what())); return applied;
+      };
+    } catch (Dali::DaliException e) {
+      {
+        SWIG_CSharpException(SWIG_UnknownError, e.condition); return applied;
+      };
+    } catch (...) {
+      {
+        SWIG_CSharpException(SWIG_UnknownError, "unknown error"); return applied;
+      };
+    }
+  }
+
+  return applied;
+}
+
+/**
+ * Reads a float, Vector2, Vector3 or Vector4 property (e.g. Actor::Property::POSITION, SIZE or COLOR)
+ * into a caller-provided float buffer, without creating a Property::Value or a vector for C#.
+ * @param[in] jarg1 The Dali::Handle
+ * @param[in] jarg2 The index of the property
+ * @param[out] jarg3 The float buffer
+ * @param[in] jarg4 The number of floats to write, 1 to 4
+ * @return true (non-zero) if the property was converted
+ */
+SWIGEXPORT unsigned int SWIGSTDCALL CSharp_Dali_Handle_GetPropertyFloats(void * jarg1, int jarg2, float * jarg3, unsigned int jarg4) {
+  Dali::Handle *arg1 = (Dali::Handle *)jarg1;
+  return GetPropertyFloats(&arg1, 1, jarg2, jarg3, jarg4, false);
+}
+
+/**
+ * As CSharp_Dali_Handle_GetPropertyFloats, reading the current value (e.g. Actor::Property::WORLD_POSITION
+ * or the animated size) instead of the event-side value.
+ */
+SWIGEXPORT unsigned int SWIGSTDCALL CSharp_Dali_Handle_GetCurrentPropertyFloats(void * jarg1, int jarg2, float * jarg3, unsigned int jarg4) {
+  Dali::Handle *arg1 = (Dali::Handle *)jarg1;
+  return GetPropertyFloats(&arg1, 1, jarg2, jarg3, jarg4, true);
+}
+
+/**
+ * Reads the same property of a number of handles in one call.
+ * @param[in] jarg1 The array of Dali::Handle pointers
+ * @param[in] jarg2 The number of handles
+ * @param[in] jarg3 The index of the property
+ * @param[out] jarg4 The float buffer, jarg2 * jarg5 floats, written handle by handle
+ * @param[in] jarg5 The number of floats per handle, 1 to 4
+ * @return true (non-zero) if the property of every handle was converted
+ */
+SWIGEXPORT unsigned int SWIGSTDCALL CSharp_Dali_Handle_GetPropertyFloatsBulk(void * jarg1, unsigned int jarg2, int jarg3, float * jarg4, unsigned int jarg5) {
+  return GetPropertyFloats((Dali::Handle * const *)jarg1, jarg2, jarg3, jarg4, jarg5, false);
+}
+
+/**
+ * As CSharp_Dali_Handle_GetPropertyFloatsBulk, reading the current values.
+ */
+SWIGEXPORT unsigned int SWIGSTDCALL CSharp_Dali_Handle_GetCurrentPropertyFloatsBulk(void * jarg1, unsigned int jarg2, int jarg3, float * jarg4, unsigned int jarg5) {
+  return GetPropertyFloats((Dali::Handle * const *)jarg1, jarg2, jarg3, jarg4, jarg5, true);
+}
+
+#ifdef __cplusplus
+}
+#endif
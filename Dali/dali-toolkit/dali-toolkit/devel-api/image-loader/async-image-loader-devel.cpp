@@ -16,6 +16,7 @@
 
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
 #include <dali-toolkit/internal/image-loader/async-image-loader-impl.h>
+#include <dali-toolkit/internal/helpers/worker-pool.h>
 
 namespace Dali
 {
@@ -24,6 +25,17 @@ namespace Toolkit
 namespace DevelAsyncImageLoader
 {
 
+namespace
+{
+
+Toolkit::Internal::WorkerPool::TaskType GetWorkerPoolTaskType( WorkerTaskType type )
+{
+  return ( type == WorkerTaskType::REMOTE ) ? Toolkit::Internal::WorkerPool::REMOTE_IMAGE_LOADING
+                                            : Toolkit::Internal::WorkerPool::LOCAL_IMAGE_LOADING;
+}
+
+} // unnamed namespace
+
 uint32_t Load( AsyncImageLoader asyncImageLoader,
                const std::string& url,
                ImageDimensions dimensions,
@@ -32,7 +44,27 @@ uint32_t Load( AsyncImageLoader asyncImageLoader,
                bool orientationCorrection,
                DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
 {
-  return GetImplementation( asyncImageLoader ).Load( Toolkit::Internal::VisualUrl(url), dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad);
+  return GetImplementation( asyncImageLoader ).Load( Toolkit::Internal::VisualUrl(url), dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad,
+                                                     DevelAsyncImageLoader::LoadPriority::VISIBLE );
+}
+
+uint32_t Load( AsyncImageLoader asyncImageLoader,
+               const std::string& url,
+               ImageDimensions dimensions,
+               FittingMode::Type fittingMode,
+               SamplingMode::Type samplingMode,
+               bool orientationCorrection,
+               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+               DevelAsyncImageLoader::LoadPriority priority )
+{
+  return GetImplementation( asyncImageLoader ).Load( Toolkit::Internal::VisualUrl(url), dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad, priority );
+}
+
+bool SetPriority( AsyncImageLoader asyncImageLoader,
+                  uint32_t loadingTaskId,
+                  DevelAsyncImageLoader::LoadPriority priority )
+{
+  return GetImplementation( asyncImageLoader ).SetPriority( loadingTaskId, priority );
 }
 
 uint32_t ApplyMask( AsyncImageLoader asyncImageLoader,
@@ -42,7 +74,8 @@ uint32_t ApplyMask( AsyncImageLoader asyncImageLoader,
                     bool cropToMask,
                     DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
 {
-  return GetImplementation( asyncImageLoader ).ApplyMask( pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad );
+  return GetImplementation( asyncImageLoader ).ApplyMask( pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad,
+                                                          DevelAsyncImageLoader::LoadPriority::VISIBLE );
 }
 
 PixelBufferLoadedSignalType& PixelBufferLoadedSignal( AsyncImageLoader asyncImageLoader )
@@ -50,6 +83,21 @@ PixelBufferLoadedSignalType& PixelBufferLoadedSignal( AsyncImageLoader asyncImag
   return GetImplementation( asyncImageLoader ).PixelBufferLoadedSignal();
 }
 
+void SetWorkerConcurrency( WorkerTaskType type, uint32_t concurrency )
+{
+  Toolkit::Internal::WorkerPool::Get().SetConcurrency( GetWorkerPoolTaskType( type ), concurrency );
+}
+
+uint32_t GetWorkerConcurrency( WorkerTaskType type )
+{
+  return Toolkit::Internal::WorkerPool::Get().GetConcurrency( GetWorkerPoolTaskType( type ) );
+}
+
+WorkerStatistics GetWorkerStatistics( WorkerTaskType type )
+{
+  return Toolkit::Internal::WorkerPool::Get().GetStatistics( GetWorkerPoolTaskType( type ) );
+}
+
 } // Devel
 } // Toolkit
 } // Dali
@@ -39,6 +39,41 @@ enum class PreMultiplyOnLoad
   ON           ///< Multiply alpha into color channels on load
 };
 
+/**
+ * @brief The order in which the queued tasks of a loader are processed
+ * A task is started before all the tasks of a lower priority; tasks of the same priority are started in request order.
+ */
+enum class LoadPriority
+{
+  VISIBLE = 0, ///< The image is shown on stage
+  PREFETCH,    ///< The image is expected to be shown soon
+  BACKGROUND   ///< The image is not expected to be shown soon
+};
+
+/**
+ * @brief The types of loading tasks, run by the worker threads shared by all the loaders
+ */
+enum class WorkerTaskType
+{
+  LOCAL = 0, ///< Loading an image from the file system, or applying a mask
+  REMOTE     ///< Downloading an image
+};
+
+/**
+ * @brief The statistics of a type of loading task
+ * @see GetWorkerStatistics()
+ */
+struct WorkerStatistics
+{
+  uint32_t submittedCount; ///< The number of tasks submitted
+  uint32_t completedCount; ///< The number of tasks completed
+  uint32_t runningCount;   ///< The number of tasks being run
+  uint32_t queueDepth;     ///< The number of tasks waiting for a worker
+  uint32_t maxQueueDepth;  ///< The highest number of tasks waiting for a worker
+  float averageLatency;    ///< The average time in milliseconds the started tasks waited for a worker
+  float maxLatency;        ///< The longest time in milliseconds a started task waited for a worker
+};
+
 /**
  * @brief Starts an image loading task.
  * @REMARK_INTERNET
@@ -60,6 +95,40 @@ DALI_TOOLKIT_API uint32_t Load( AsyncImageLoader asyncImageLoader,
                                 bool orientationCorrection,
                                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
 
+/**
+ * @brief Starts an image loading task with a priority.
+ * @REMARK_INTERNET
+ * @REMARK_STORAGE
+ * @param[in] asyncImageLoader The ayncImageLoader
+ * @param[in] url The URL of the image file to load
+ * @param[in] dimensions The width and height to fit the loaded image to
+ * @param[in] fittingMode The method used to fit the shape of the image before loading to the shape defined by the size parameter
+ * @param[in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size
+ * @param[in] orientationCorrection Reorient the image to respect any orientation metadata in its header
+ * @param[in] preMultiplyOnLoad ON if the image color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
+ * @param[in] priority The priority of the task
+ * @return The loading task id
+ */
+DALI_TOOLKIT_API uint32_t Load( AsyncImageLoader asyncImageLoader,
+                                const std::string& url,
+                                ImageDimensions dimensions,
+                                FittingMode::Type fittingMode,
+                                SamplingMode::Type samplingMode,
+                                bool orientationCorrection,
+                                DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                DevelAsyncImageLoader::LoadPriority priority );
+
+/**
+ * @brief Changes the priority of a task which has not started yet.
+ * @param[in] asyncImageLoader The ayncImageLoader
+ * @param[in] loadingTaskId The id of the task
+ * @param[in] priority The new priority of the task
+ * @return true if the task is still waiting to be processed, false otherwise
+ */
+DALI_TOOLKIT_API bool SetPriority( AsyncImageLoader asyncImageLoader,
+                                   uint32_t loadingTaskId,
+                                   DevelAsyncImageLoader::LoadPriority priority );
+
 /**
  * @brief Starts an mask applying task.
  * @REMARK_INTERNET
@@ -85,6 +154,29 @@ DALI_TOOLKIT_API uint32_t ApplyMask( AsyncImageLoader asyncImageLoader,
  */
 DALI_TOOLKIT_API PixelBufferLoadedSignalType&  PixelBufferLoadedSignal( AsyncImageLoader asyncImageLoader );
 
+/**
+ * @brief Sets the maximum number of tasks of a type run at the same time by the worker threads.
+ * By default, as many local tasks as hardware threads are run, and 8 downloads, as they mostly wait for the network.
+ * The DALI_TOOLKIT_WORKER_THREADS environment variable overrides the default for the local tasks.
+ * @param[in] type The type of the tasks
+ * @param[in] concurrency The maximum number of tasks run at the same time, at least 1
+ */
+DALI_TOOLKIT_API void SetWorkerConcurrency( WorkerTaskType type, uint32_t concurrency );
+
+/**
+ * @brief Retrieves the maximum number of tasks of a type run at the same time by the worker threads.
+ * @param[in] type The type of the tasks
+ * @return The maximum number of tasks run at the same time
+ */
+DALI_TOOLKIT_API uint32_t GetWorkerConcurrency( WorkerTaskType type );
+
+/**
+ * @brief Retrieves the statistics of a type of task run by the worker threads.
+ * @param[in] type The type of the tasks
+ * @return The statistics since the first task was submitted
+ */
+DALI_TOOLKIT_API WorkerStatistics GetWorkerStatistics( WorkerTaskType type );
+
 }
 } // Toolkit
 } // Dali
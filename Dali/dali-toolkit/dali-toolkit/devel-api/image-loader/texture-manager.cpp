@@ -50,6 +50,27 @@ TextureSet RemoveTexture( const std::string& textureUrl )
   return textureMgr.RemoveExternalTexture( textureUrl );
 }
 
+void SetCacheBudget( uint64_t budget )
+{
+  auto visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr = GetImplementation( visualFactory ).GetTextureManager();
+  textureMgr.SetCacheBudget( budget );
+}
+
+uint64_t GetCacheBudget()
+{
+  auto visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr = GetImplementation( visualFactory ).GetTextureManager();
+  return textureMgr.GetCacheBudget();
+}
+
+CacheStatistics GetCacheStatistics()
+{
+  auto visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr = GetImplementation( visualFactory ).GetTextureManager();
+  return textureMgr.GetCacheStatistics();
+}
+
 } // TextureManager
 
 } // Toolkit
@@ -18,6 +18,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstdint>
 #include <dali/public-api/rendering/texture-set.h>
 
 // INTERNAL INCLUDES
@@ -36,6 +37,20 @@ namespace Toolkit
 namespace TextureManager
 {
 
+/**
+ * @brief Statistics of the cache of the images loaded by the visuals
+ * @see GetCacheStatistics()
+ */
+struct CacheStatistics
+{
+  uint32_t requestCount;     ///< The number of image loads requested
+  uint32_t hitCount;         ///< The number of requests served by a cached texture, without loading the image again
+  uint32_t releasedHitCount; ///< The number of hits on textures kept cached after their last user released them
+  uint32_t evictionCount;    ///< The number of released textures removed to stay within the cache budget
+  uint64_t residentSize;     ///< The size in bytes of all the textures uploaded by the texture manager
+  uint64_t releasedSize;     ///< The size in bytes of the released textures kept cached
+};
+
 /**
  * @brief Add a Texture to texture manager
  * Toolkit keeps the Texture handle until RemoveTexture is called.
@@ -64,6 +79,29 @@ DALI_TOOLKIT_API std::string AddTexture( TextureSet& textureSet );
  */
 DALI_TOOLKIT_API TextureSet RemoveTexture( const std::string& textureUrl );
 
+/**
+ * @brief Sets the GPU memory budget of the cache of the images loaded by the visuals
+ * By default the budget is 0, and a texture is deleted as soon as its last user releases it.
+ * With a budget, released textures stay cached, so that loading the same image again uploads nothing;
+ * when the size of all the uploaded textures exceeds the budget, the released textures are deleted,
+ * least recently released first.
+ * @note Atlased and masked textures are always deleted when released
+ * @param[in] budget The budget in bytes
+ */
+DALI_TOOLKIT_API void SetCacheBudget( uint64_t budget );
+
+/**
+ * @brief Retrieves the GPU memory budget of the cache of the images loaded by the visuals
+ * @return The budget in bytes
+ */
+DALI_TOOLKIT_API uint64_t GetCacheBudget();
+
+/**
+ * @brief Retrieves the statistics of the cache of the images loaded by the visuals
+ * @return The statistics since the toolkit was initialised
+ */
+DALI_TOOLKIT_API CacheStatistics GetCacheStatistics();
+
 } // TextureManager
 
 } // Toolkit
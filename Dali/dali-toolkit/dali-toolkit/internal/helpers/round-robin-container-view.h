@@ -77,6 +77,18 @@ public:
     return mElements.begin() + mNextIndex++;
   }
 
+  /**
+   * @brief Returns the iterator to the first element of the container.
+   *
+   * Can be used with End() to visit all the elements, regardless of the position of GetNext().
+   *
+   * @return The container begin() element
+   */
+  typename ContainerType::iterator Begin()
+  {
+    return mElements.begin();
+  }
+
   /**
    * @brief Returns the iterator to the end of the container.
    *
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/helpers/worker-pool.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+
+namespace
+{
+
+constexpr auto NUMBER_OF_WORKER_THREADS_ENV = "DALI_TOOLKIT_WORKER_THREADS";
+constexpr auto DEFAULT_NUMBER_OF_WORKER_THREADS = 4u; ///< Used when the number of hardware threads is unknown
+constexpr auto MAX_NUMBER_OF_WORKER_THREADS = 100u;
+constexpr auto DEFAULT_NUMBER_OF_DOWNLOADS = 8u;      ///< As many as the remote loader threads used before the pool
+
+uint32_t GetNumberOfWorkerThreads()
+{
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto numberString = GetEnvironmentVariable( NUMBER_OF_WORKER_THREADS_ENV );
+  auto numberOfThreads = numberString ? std::strtoul( numberString, nullptr, 10 ) : 0;
+  if( numberOfThreads == 0 || numberOfThreads >= MAX_NUMBER_OF_WORKER_THREADS )
+  {
+    numberOfThreads = std::thread::hardware_concurrency();
+  }
+  return ( numberOfThreads > 0 && numberOfThreads < MAX_NUMBER_OF_WORKER_THREADS ) ? numberOfThreads : DEFAULT_NUMBER_OF_WORKER_THREADS;
+}
+
+} // unnamed namespace
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+WorkerPool& WorkerPool::Get()
+{
+  static WorkerPool pool;
+  return pool;
+}
+
+WorkerPool::WorkerPool()
+: mWorkers(),
+  mQueues(),
+  mConditionalWait(),
+  mTerminate( false )
+{
+  for( auto&& queue : mQueues )
+  {
+    queue.statistics = Statistics();
+    queue.totalLatency = 0.0;
+  }
+
+  mQueues[ LOCAL_IMAGE_LOADING ].concurrency = GetNumberOfWorkerThreads();
+
+  // Downloads mostly wait for the network; they have workers of their own, so they do not hold up the local images
+  mQueues[ REMOTE_IMAGE_LOADING ].concurrency = DEFAULT_NUMBER_OF_DOWNLOADS;
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+
+  for( auto&& worker : mWorkers )
+  {
+    worker->Join();
+  }
+}
+
+void WorkerPool::Submit( TaskType type, Task task )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  if( mWorkers.Empty() )
+  {
+    StartWorkers();
+  }
+
+  TaskQueue& queue = mQueues[ type ];
+  queue.tasks.push_back( QueuedTask{ std::move( task ), std::chrono::steady_clock::now() } );
+
+  Statistics& statistics = queue.statistics;
+  ++statistics.submittedCount;
+  statistics.queueDepth = static_cast<uint32_t>( queue.tasks.size() );
+  statistics.maxQueueDepth = std::max( statistics.maxQueueDepth, statistics.queueDepth );
+
+  mConditionalWait.Notify( lock );
+}
+
+void WorkerPool::SetConcurrency( TaskType type, uint32_t concurrency )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  mQueues[ type ].concurrency = std::max( 1u, concurrency );
+
+  if( !mWorkers.Empty() )
+  {
+    StartWorkers();
+  }
+
+  // Queued tasks may be allowed to start now
+  mConditionalWait.Notify( lock );
+}
+
+uint32_t WorkerPool::GetConcurrency( TaskType type ) const
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+  return mQueues[ type ].concurrency;
+}
+
+WorkerPool::Statistics WorkerPool::GetStatistics( TaskType type ) const
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  const TaskQueue& queue = mQueues[ type ];
+  Statistics statistics = queue.statistics;
+  const uint32_t startedCount = statistics.submittedCount - statistics.queueDepth;
+  statistics.averageLatency = startedCount > 0u ? static_cast<float>( queue.totalLatency / startedCount ) : 0.0f;
+  return statistics;
+}
+
+bool WorkerPool::RunNextTask()
+{
+  TaskType type;
+  Task task;
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    while( !mTerminate && !FindNextTask( type ) )
+    {
+      mConditionalWait.Wait( lock );
+    }
+
+    if( mTerminate )
+    {
+      return false;
+    }
+
+    TaskQueue& queue = mQueues[ type ];
+    QueuedTask& next = queue.tasks.front();
+    const float latency = std::chrono::duration< float, std::milli >( std::chrono::steady_clock::now() - next.submitTime ).count();
+    task = std::move( next.task );
+    queue.tasks.pop_front();
+
+    Statistics& statistics = queue.statistics;
+    ++statistics.runningCount;
+    statistics.queueDepth = static_cast<uint32_t>( queue.tasks.size() );
+    statistics.maxLatency = std::max( statistics.maxLatency, latency );
+    queue.totalLatency += latency;
+  }
+
+  task();
+
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+
+    TaskQueue& queue = mQueues[ type ];
+    --queue.statistics.runningCount;
+    ++queue.statistics.completedCount;
+
+    // A worker may be waiting for the type to be under its limit
+    if( !queue.tasks.empty() )
+    {
+      mConditionalWait.Notify( lock );
+    }
+  }
+
+  return true;
+}
+
+void WorkerPool::StartWorkers()
+{
+  uint32_t workerCount = 0u;
+  for( auto&& queue : mQueues )
+  {
+    workerCount += queue.concurrency;
+  }
+
+  if( mWorkers.Count() < workerCount )
+  {
+    const LogFactoryInterface& logFactory = Dali::Adaptor::Get().GetLogFactory();
+    mWorkers.Reserve( workerCount );
+    for( uint32_t i = static_cast<uint32_t>( mWorkers.Count() ); i < workerCount; ++i )
+    {
+      mWorkers.PushBack( new Worker( *this, logFactory ) );
+      mWorkers[ i ]->Start();
+    }
+  }
+}
+
+bool WorkerPool::FindNextTask( TaskType& type ) const
+{
+  bool found = false;
+  for( int i = 0; i < TASK_TYPE_COUNT; ++i )
+  {
+    const TaskQueue& queue = mQueues[ i ];
+    if( !queue.tasks.empty() && queue.statistics.runningCount < queue.concurrency &&
+        ( !found || queue.tasks.front().submitTime < mQueues[ type ].tasks.front().submitTime ) )
+    {
+      type = static_cast< TaskType >( i );
+      found = true;
+    }
+  }
+  return found;
+}
+
+WorkerPool::Worker::Worker( WorkerPool& pool, const LogFactoryInterface& logFactory )
+: mPool( pool ),
+  mLogFactory( logFactory )
+{
+}
+
+void WorkerPool::Worker::Run()
+{
+  SetThreadName( "DaliWorker" );
+  mLogFactory.InstallLogFunction();
+
+  while( mPool.RunNextTask() )
+  {
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
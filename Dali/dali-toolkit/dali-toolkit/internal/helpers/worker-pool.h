@@ -0,0 +1,204 @@
+#ifndef DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
+#define DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
+
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <dali/devel-api/common/owner-container.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
+
+namespace Dali
+{
+
+class LogFactoryInterface;
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * The worker threads shared by the background work of the toolkit.
+ *
+ * The tasks are queued by type, and each type is limited to a number of workers; the workers take the oldest
+ * task of the types which have not reached their limit. There are as many workers as the sum of the limits,
+ * so a type always gets its share. The limit of the local image loading is read from the
+ * DALI_TOOLKIT_WORKER_THREADS environment variable, and defaults to the number of hardware threads.
+ * Downloads mostly wait for the network, so they have their own workers.
+ * The limits and the statistics are exposed through DevelAsyncImageLoader.
+ *
+ * A subsystem with its own order or cancellation keeps its tasks in its own queue, and submits a task
+ * which processes the next one of its queue.
+ */
+class WorkerPool
+{
+public:
+
+  /**
+   * The types of the tasks
+   */
+  enum TaskType
+  {
+    LOCAL_IMAGE_LOADING,  ///< Loading an image from the file system, or applying a mask
+    REMOTE_IMAGE_LOADING, ///< Downloading an image
+    TASK_TYPE_COUNT
+  };
+
+  typedef std::function< void() > Task; ///< A task is run once by a worker thread
+
+  typedef DevelAsyncImageLoader::WorkerStatistics Statistics; ///< The statistics of a type of task
+
+  /**
+   * Retrieve the worker pool; the workers are started by the first task submitted.
+   * @return The worker pool
+   */
+  static WorkerPool& Get();
+
+  /**
+   * Submit a task, called by main thread.
+   * @param[in] type The type of the task
+   * @param[in] task The task
+   */
+  void Submit( TaskType type, Task task );
+
+  /**
+   * Limit the number of workers which can run the tasks of a type at the same time, called by main thread.
+   * More workers are started if the sum of the limits exceeds the number of workers.
+   * @param[in] type The type of the tasks
+   * @param[in] concurrency The maximum number of workers, at least 1
+   */
+  void SetConcurrency( TaskType type, uint32_t concurrency );
+
+  /**
+   * Retrieve the maximum number of workers which can run the tasks of a type at the same time.
+   * @param[in] type The type of the tasks
+   * @return The maximum number of workers
+   */
+  uint32_t GetConcurrency( TaskType type ) const;
+
+  /**
+   * Retrieve the statistics of a type of task.
+   * @param[in] type The type of the tasks
+   * @return The statistics
+   */
+  Statistics GetStatistics( TaskType type ) const;
+
+private:
+
+  /**
+   * A worker thread, which runs the tasks until the pool is destroyed
+   */
+  class Worker : public Thread
+  {
+  public:
+
+    /**
+     * Constructor
+     * @param[in] pool The pool of the worker
+     * @param[in] logFactory The log factory of the main thread
+     */
+    Worker( WorkerPool& pool, const LogFactoryInterface& logFactory );
+
+  protected:
+
+    /**
+     * The entry function of the worker thread.
+     */
+    virtual void Run();
+
+  private:
+
+    WorkerPool& mPool;
+    const LogFactoryInterface& mLogFactory;
+  };
+
+  /**
+   * A task waiting for a worker
+   */
+  struct QueuedTask
+  {
+    Task task;                                          ///< The task
+    std::chrono::steady_clock::time_point submitTime;   ///< When the task was submitted
+  };
+
+  /**
+   * The queue and the statistics of a type of task
+   */
+  struct TaskQueue
+  {
+    std::deque< QueuedTask > tasks;                     ///< The tasks waiting for a worker
+    Statistics statistics;                              ///< The statistics of the type
+    double totalLatency;                                ///< The sum of the latencies of the started tasks
+    uint32_t concurrency;                               ///< The maximum number of workers running the tasks
+  };
+
+  /**
+   * Constructor
+   */
+  WorkerPool();
+
+  /**
+   * Destructor; the workers are stopped, and the queued tasks are discarded.
+   */
+  ~WorkerPool();
+
+  // Undefined
+  WorkerPool( const WorkerPool& );
+
+  // Undefined
+  WorkerPool& operator=( const WorkerPool& );
+
+  /**
+   * Wait for a task and run it, called by worker thread.
+   * @return false when the pool is destroyed, true otherwise
+   */
+  bool RunNextTask();
+
+  /**
+   * Start workers until there are as many as the sum of the limits of the types; the lock must be held.
+   */
+  void StartWorkers();
+
+  /**
+   * Find the type of the task to run next; the lock must be held.
+   * @param[out] type The type of the task
+   * @return true if a task can be run
+   */
+  bool FindNextTask( TaskType& type ) const;
+
+private:
+
+  OwnerContainer< Worker* > mWorkers;                   ///< The worker threads
+  TaskQueue                 mQueues[ TASK_TYPE_COUNT ]; ///< The queued tasks of each type
+  mutable ConditionalWait   mConditionalWait;           ///< Guards the queues, and wakes up the workers
+  bool                      mTerminate;                 ///< Whether the workers have to stop
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
@@ -33,8 +33,7 @@ namespace Internal
 AsyncImageLoader::AsyncImageLoader()
 : mLoadedSignal(),
   mLoadThread( new EventThreadCallback( MakeCallback( this, &AsyncImageLoader::ProcessLoadedImage ) ) ),
-  mLoadTaskId( 0u ),
-  mIsLoadThreadStarted( false )
+  mLoadTaskId( 0u )
 {
 }
 
@@ -54,14 +53,10 @@ uint32_t AsyncImageLoader::Load( const VisualUrl& url,
                                  FittingMode::Type fittingMode,
                                  SamplingMode::Type samplingMode,
                                  bool orientationCorrection,
-                                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
+                                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                 DevelAsyncImageLoader::LoadPriority priority )
 {
-  if( !mIsLoadThreadStarted )
-  {
-    mLoadThread.Start();
-    mIsLoadThreadStarted = true;
-  }
-  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, url, dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad ) );
+  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, url, dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad, priority ) );
 
   return mLoadTaskId;
 }
@@ -70,14 +65,10 @@ uint32_t AsyncImageLoader::ApplyMask( Devel::PixelBuffer pixelBuffer,
                                       Devel::PixelBuffer maskPixelBuffer,
                                       float contentScale,
                                       bool cropToMask,
-                                      DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
+                                      DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                      DevelAsyncImageLoader::LoadPriority priority )
 {
-  if( !mIsLoadThreadStarted )
-  {
-    mLoadThread.Start();
-    mIsLoadThreadStarted = true;
-  }
-  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad ) );
+  mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad, priority ) );
 
   return mLoadTaskId;
 }
@@ -97,6 +88,11 @@ bool AsyncImageLoader::Cancel( uint32_t loadingTaskId )
   return mLoadThread.CancelTask( loadingTaskId );
 }
 
+bool AsyncImageLoader::SetPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  return mLoadThread.SetTaskPriority( loadingTaskId, priority );
+}
+
 void AsyncImageLoader::CancelAll()
 {
   mLoadThread.CancelAll();
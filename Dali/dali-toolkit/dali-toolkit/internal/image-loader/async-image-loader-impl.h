@@ -50,14 +50,15 @@ public:
   static IntrusivePtr<AsyncImageLoader> New();
 
   /**
-   * @copydoc Toolkit::AsyncImageLoader::Load( const std::string&, ImageDimensions, FittingMode::Type, SamplingMode::Type, bool , DevelAsyncImageLoader::PreMultiplyOnLoad )
+   * @copydoc Toolkit::DevelAsyncImageLoader::Load( AsyncImageLoader, const std::string&, ImageDimensions, FittingMode::Type, SamplingMode::Type, bool, DevelAsyncImageLoader::PreMultiplyOnLoad, DevelAsyncImageLoader::LoadPriority )
    */
   uint32_t Load( const VisualUrl& url,
                  ImageDimensions dimensions,
                  FittingMode::Type fittingMode,
                  SamplingMode::Type samplingMode,
                  bool orientationCorrection,
-                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
+                 DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                 DevelAsyncImageLoader::LoadPriority priority );
 
   /**
    * @brief Starts an mask applying task.
@@ -66,13 +67,15 @@ public:
    * @param[in] contentScale The factor to scale the content
    * @param[in] cropToMask Whether to crop the content to the mask size
    * @param[in] preMultiplyOnLoad ON if the image color should be multiplied by it's alpha. Set to OFF if there is no alpha.
+   * @param[in] priority The priority of the task
    * @return The loading task id
    */
   uint32_t ApplyMask( Devel::PixelBuffer pixelBuffer,
                       Devel::PixelBuffer maskPixelBuffer,
                       float contentScale,
                       bool cropToMask,
-                      DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
+                      DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                      DevelAsyncImageLoader::LoadPriority priority );
 
   /**
    * @copydoc Toolkit::AsyncImageLoader::ImageLoadedSignal
@@ -89,6 +92,11 @@ public:
    */
   bool Cancel( uint32_t loadingTaskId );
 
+  /**
+   * @copydoc Toolkit::DevelAsyncImageLoader::SetPriority
+   */
+  bool SetPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority );
+
   /**
    * @copydoc Toolkit::AsyncImageLoader::CancelAll
    */
@@ -112,7 +120,6 @@ private:
 
   ImageLoadThread mLoadThread;
   uint32_t        mLoadTaskId;
-  bool            mIsLoadThreadStarted;
 };
 
 } // namespace Internal
@@ -20,8 +20,6 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/image-loading.h>
-#include <dali/devel-api/adaptor-framework/thread-settings.h>
-#include <dali/integration-api/adaptor-framework/adaptor.h>
 
 namespace Dali
 {
@@ -33,7 +31,8 @@ namespace Internal
 {
 
 LoadingTask::LoadingTask( uint32_t id, const VisualUrl& url, ImageDimensions dimensions,
-                          FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
+                          FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                          DevelAsyncImageLoader::LoadPriority priority )
 : pixelBuffer(),
   url( url ),
   id( id ),
@@ -45,12 +44,13 @@ LoadingTask::LoadingTask( uint32_t id, const VisualUrl& url, ImageDimensions dim
   isMaskTask( false ),
   maskPixelBuffer(),
   contentScale( 1.0f ),
-  cropToMask( false )
+  cropToMask( false ),
+  priority( priority )
 {
 }
 
 LoadingTask::LoadingTask( uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::PixelBuffer maskPixelBuffer, float contentScale, bool cropToMask,
-                          DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
+                          DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad, DevelAsyncImageLoader::LoadPriority priority )
 : pixelBuffer( pixelBuffer ),
   url( "" ),
   id( id ),
@@ -62,7 +62,8 @@ LoadingTask::LoadingTask( uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::Pi
   isMaskTask( true ),
   maskPixelBuffer( maskPixelBuffer ),
   contentScale( contentScale ),
-  cropToMask( cropToMask )
+  cropToMask( cropToMask ),
+  priority( priority )
 {
 }
 
@@ -96,26 +97,78 @@ void LoadingTask::MultiplyAlpha()
 
 ImageLoadThread::ImageLoadThread( EventThreadCallback* trigger )
 : mTrigger( trigger ),
-  mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
+  mTaskToken( std::make_shared< TaskToken >() )
 {
+  mTaskToken->thread = this;
+  mTaskToken->runningCount = 0u;
 }
 
 ImageLoadThread::~ImageLoadThread()
 {
-  // add an empty task would stop the thread from conditional wait.
-  AddTask( NULL );
-  // stop the thread
-  Join();
+  CancelAll();
+
+  {
+    // The tasks still waiting for a worker do nothing, so only the ones being run are waited for
+    ConditionalWait::ScopedLock lock( mTaskToken->conditionalWait );
+    mTaskToken->thread = NULL;
+    while( mTaskToken->runningCount > 0u )
+    {
+      mTaskToken->conditionalWait.Wait( lock );
+    }
+  }
+
+  for( Vector< LoadingTask* >::Iterator iter = mCompleteQueue.Begin(); iter != mCompleteQueue.End(); ++iter )
+  {
+    delete ( *iter );
+  }
 
   delete mTrigger;
 }
 
-void ImageLoadThread::Run()
+void ImageLoadThread::AddTask( LoadingTask* task )
 {
-  SetThreadName( "ImageLoadThread" );
-  mLogFactory.InstallLogFunction();
+  const WorkerPool::TaskType type = GetTaskType( *task );
 
-  while( LoadingTask* task = NextTaskToProcess() )
+  {
+    // Lock while adding task to the queue
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mLoadQueues[ type ].PushBack( task );
+  }
+
+  std::shared_ptr< TaskToken > token = mTaskToken;
+  WorkerPool::Get().Submit( type, [token, type]() { RunTask( *token, type ); } );
+}
+
+WorkerPool::TaskType ImageLoadThread::GetTaskType( const LoadingTask& task )
+{
+  // Downloads are limited separately, as they mostly wait for the network
+  return ( task.isMaskTask || task.url.IsLocalResource() ) ? WorkerPool::LOCAL_IMAGE_LOADING : WorkerPool::REMOTE_IMAGE_LOADING;
+}
+
+void ImageLoadThread::RunTask( TaskToken& token, WorkerPool::TaskType type )
+{
+  ImageLoadThread* thread;
+  {
+    ConditionalWait::ScopedLock lock( token.conditionalWait );
+    thread = token.thread;
+    if( !thread )
+    {
+      return;
+    }
+    ++token.runningCount;
+  }
+
+  thread->ProcessNextTask( type );
+
+  // Notify while locked, as the destructor of the queue may be waiting for this task only
+  ConditionalWait::ScopedLock lock( token.conditionalWait );
+  --token.runningCount;
+  token.conditionalWait.Notify( lock );
+}
+
+void ImageLoadThread::ProcessNextTask( WorkerPool::TaskType type )
+{
+  if( LoadingTask* task = NextTaskToProcess( type ) )
   {
     if( !task->isMaskTask )
     {
@@ -131,24 +184,6 @@ void ImageLoadThread::Run()
   }
 }
 
-void ImageLoadThread::AddTask( LoadingTask* task )
-{
-  bool wasEmpty = false;
-
-  {
-    // Lock while adding task to the queue
-    ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mLoadQueue.Empty();
-    mLoadQueue.PushBack( task );
-  }
-
-  if( wasEmpty )
-  {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
-  }
-}
-
 LoadingTask* ImageLoadThread::NextCompletedTask()
 {
   // Lock while popping task out from the queue
@@ -171,13 +206,16 @@ bool ImageLoadThread::CancelTask( uint32_t loadingTaskId )
   // Lock while remove task from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
+  for( auto&& loadQueue : mLoadQueues )
   {
-    if( (*iter)->id == loadingTaskId )
+    for( Vector< LoadingTask* >::Iterator iter = loadQueue.Begin(); iter != loadQueue.End(); ++iter )
     {
-      delete (*iter);
-      mLoadQueue.Erase( iter );
-      return true;
+      if( (*iter)->id == loadingTaskId )
+      {
+        delete (*iter);
+        loadQueue.Erase( iter );
+        return true;
+      }
     }
   }
 
@@ -190,26 +228,60 @@ void ImageLoadThread::CancelAll()
   // Lock while remove task from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
+  for( auto&& loadQueue : mLoadQueues )
   {
-    delete ( *iter );
+    for( Vector< LoadingTask* >::Iterator iter = loadQueue.Begin(); iter != loadQueue.End(); ++iter )
+    {
+      delete ( *iter );
+    }
+    loadQueue.Clear();
   }
-  mLoadQueue.Clear();
 }
 
-LoadingTask* ImageLoadThread::NextTaskToProcess()
+bool ImageLoadThread::SetTaskPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  // Lock while changing the task in the queue
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  for( auto&& loadQueue : mLoadQueues )
+  {
+    for( Vector< LoadingTask* >::Iterator iter = loadQueue.Begin(); iter != loadQueue.End(); ++iter )
+    {
+      if( (*iter)->id == loadingTaskId )
+      {
+        (*iter)->priority = priority;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+LoadingTask* ImageLoadThread::NextTaskToProcess( WorkerPool::TaskType type )
 {
   // Lock while popping task out from the queue
   ConditionalWait::ScopedLock lock( mConditionalWait );
 
-  while( mLoadQueue.Empty() )
+  Vector< LoadingTask* >& loadQueue = mLoadQueues[ type ];
+  if( loadQueue.Empty() )
   {
-    mConditionalWait.Wait( lock );
+    return NULL;
+  }
+
+  // Find the first task of the highest priority
+  Vector< LoadingTask* >::Iterator next = loadQueue.Begin();
+  for( Vector< LoadingTask* >::Iterator iter = next + 1, endIter = loadQueue.End();
+       iter != endIter && (*next)->priority != DevelAsyncImageLoader::LoadPriority::VISIBLE; ++iter )
+  {
+    if( (*iter)->priority < (*next)->priority )
+    {
+      next = iter;
+    }
   }
 
-  Vector< LoadingTask* >::Iterator next = mLoadQueue.Begin();
   LoadingTask* nextTask = *next;
-  mLoadQueue.Erase( next );
+  loadQueue.Erase( next );
 
   return nextTask;
 }
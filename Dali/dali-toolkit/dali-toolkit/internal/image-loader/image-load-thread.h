@@ -18,17 +18,17 @@
  */
 
 // EXTERNAL INCLUDES
+#include <memory>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/mutex.h>
-#include <dali/devel-api/threading/thread.h>
 #include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
-#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+#include <dali-toolkit/internal/helpers/worker-pool.h>
 
 namespace Dali
 {
@@ -53,6 +53,7 @@ struct LoadingTask
    * @param [in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size.
    * @param [in] orientationCorrection Reorient the image to respect any orientation metadata in its header.
    * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
+   * @param [in] priority The priority of the task
    */
   LoadingTask( uint32_t id,
                const VisualUrl& url,
@@ -60,7 +61,8 @@ struct LoadingTask
                FittingMode::Type fittingMode,
                SamplingMode::Type samplingMode,
                bool orientationCorrection,
-               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
+               DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+               DevelAsyncImageLoader::LoadPriority priority );
 
   /**
    * Constructor.
@@ -70,13 +72,15 @@ struct LoadingTask
    * @param [in] contentScale The factor to scale the content
    * @param [in] cropToMask Whether to crop the content to the mask size
    * @param [in] preMultiplyOnLoad ON if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha.
+   * @param [in] priority The priority of the task
    */
   LoadingTask( uint32_t id,
               Devel::PixelBuffer pixelBuffer,
               Devel::PixelBuffer maskPixelBuffer,
               float contentScale,
               bool cropToMask,
-              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
+              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+              DevelAsyncImageLoader::LoadPriority priority );
 
   /**
    * Load the image
@@ -117,13 +121,17 @@ public:
   Devel::PixelBuffer maskPixelBuffer; ///< pixelBuffer of mask image
   float contentScale;               ///< The factor to scale the content
   bool cropToMask;                  ///< Whether to crop the content to the mask size
+  DevelAsyncImageLoader::LoadPriority priority; ///< The priority of the task in the loading queue
 };
 
 
 /**
- * The worker thread for image loading.
+ * The queue of the image loading tasks of a loader.
+ *
+ * The tasks are run by the threads of the WorkerPool; the loader processes the completed tasks in the main thread.
+ * The tasks are queued by the type of the worker pool task which runs them, so the limit of each type holds.
  */
-class ImageLoadThread : public Thread
+class ImageLoadThread
 {
 public:
 
@@ -136,8 +144,9 @@ public:
 
   /**
    * Destructor.
+   * The tasks in the waiting queue are removed, and the tasks being processed by the workers are waited for.
    */
-  virtual ~ImageLoadThread();
+  ~ImageLoadThread();
 
   /**
    * Add a task in to the loading queue
@@ -165,29 +174,66 @@ public:
    */
   void CancelAll();
 
+  /**
+   * Change the priority of a loading task in the waiting queue.
+   *
+   * @param[in] loadingTaskId The id of the task
+   * @param[in] priority The new priority of the task
+   * @return true if the task is in the waiting queue, false otherwise
+   */
+  bool SetTaskPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority );
+
 private:
 
   /**
-   * Pop the next loading task out from the queue to process.
+   * Shared by the worker pool tasks submitted by the queue, which may still be waiting for a worker when the queue is destroyed
+   */
+  struct TaskToken
+  {
+    ConditionalWait  conditionalWait; ///< Guards the members, and wakes up the destructor of the queue
+    ImageLoadThread* thread;          ///< The queue, or NULL once it is being destroyed
+    uint32_t         runningCount;    ///< The number of worker pool tasks of the queue being run
+  };
+
+  /**
+   * Retrieve the type of the worker pool task which runs a loading task.
    *
-   * @return The next task to be processed.
+   * @param[in] task The loading task
+   * @return The type of the worker pool task
    */
-  LoadingTask* NextTaskToProcess();
+  static WorkerPool::TaskType GetTaskType( const LoadingTask& task );
 
   /**
-   * Add a task in to the loading queue
+   * Process the next loading task of a type if the queue still exists, called by worker thread.
    *
-   * @param[in] task The task added to the queue.
+   * @param[in] token The token of the queue
+   * @param[in] type The type of the worker pool task
    */
-  void AddCompletedTask( LoadingTask* task );
+  static void RunTask( TaskToken& token, WorkerPool::TaskType type );
 
-protected:
+  /**
+   * Pop the next loading task of a type out from the queue and process it, called by worker thread.
+   * A worker pool task is submitted for each loading task added, so this does nothing if the task was cancelled.
+   *
+   * @param[in] type The type of the worker pool task
+   */
+  void ProcessNextTask( WorkerPool::TaskType type );
 
   /**
-   * The entry function of the worker thread.
-   * It fetches loading task from the loadQueue, loads the image and adds to the completeQueue.
+   * Pop the next loading task of a type out from the queue to process.
+   * This is the first task of the highest priority of that type.
+   *
+   * @param[in] type The type of the worker pool task
+   * @return The next task to be processed, or NULL if there is no task of that type.
    */
-  virtual void Run();
+  LoadingTask* NextTaskToProcess( WorkerPool::TaskType type );
+
+  /**
+   * Add a task in to the loading queue
+   *
+   * @param[in] task The task added to the queue.
+   */
+  void AddCompletedTask( LoadingTask* task );
 
 private:
 
@@ -199,13 +245,13 @@ private:
 
 private:
 
-  Vector< LoadingTask* > mLoadQueue;     ///<The task queue with images for loading.
+  Vector< LoadingTask* > mLoadQueues[ WorkerPool::TASK_TYPE_COUNT ]; ///<The task queues with images for loading, by worker pool task type.
   Vector< LoadingTask* > mCompleteQueue; ///<The task queue with images loaded.
   EventThreadCallback*   mTrigger;
-  const Dali::LogFactoryInterface& mLogFactory; ///< The log factory
 
-  ConditionalWait        mConditionalWait;
+  ConditionalWait        mConditionalWait; ///< Guards the loading queue
   Dali::Mutex            mMutex;
+  std::shared_ptr< TaskToken > mTaskToken; ///< Shared with the worker pool tasks of the queue
 };
 
 } // namespace Internal
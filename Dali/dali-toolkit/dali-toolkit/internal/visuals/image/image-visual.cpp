@@ -174,6 +174,7 @@ ImageVisual::ImageVisual( VisualFactoryCache& factoryCache,
   mDesiredSize( size ),
   mTextureId( TextureManager::INVALID_TEXTURE_ID ),
   mTextures(),
+  mLoadPriority( DevelAsyncImageLoader::LoadPriority::VISIBLE ),
   mImageVisualShaderFactory( shaderFactory ),
   mFittingMode( fittingMode ),
   mSamplingMode( samplingMode ),
@@ -200,6 +201,7 @@ ImageVisual::ImageVisual( VisualFactoryCache& factoryCache, ImageVisualShaderFac
   mDesiredSize(),
   mTextureId( TextureManager::INVALID_TEXTURE_ID ),
   mTextures(),
+  mLoadPriority( DevelAsyncImageLoader::LoadPriority::VISIBLE ),
   mImageVisualShaderFactory( shaderFactory ),
   mFittingMode( FittingMode::DEFAULT ),
   mSamplingMode( SamplingMode::DEFAULT ),
@@ -319,6 +321,9 @@ void ImageVisual::DoSetProperties( const Property::Map& propertyMap )
     auto attemptAtlasing = AttemptAtlasing();
     LoadTexture( attemptAtlasing, mAtlasRect, mTextures, mOrientationCorrection,
                  TextureManager::ReloadPolicy::CACHED  );
+
+    // Not shown yet; images of visuals on stage are loaded first
+    SetTexturePriority( DevelAsyncImageLoader::LoadPriority::PREFETCH );
   }
 }
 
@@ -769,6 +774,7 @@ void ImageVisual::DoSetOnStage( Actor& actor )
   if( mImageUrl.IsValid() )
   {
     InitializeRenderer();
+    SetTexturePriority( DevelAsyncImageLoader::LoadPriority::VISIBLE );
   }
   else if( mImage )
   {
@@ -812,9 +818,14 @@ void ImageVisual::DoSetOffStage( Actor& actor )
   actor.RemoveRenderer( mImpl->mRenderer);
   if( mReleasePolicy == Toolkit::ImageVisual::ReleasePolicy::DETACHED )
   {
-    RemoveTexture(); // If INVALID_TEXTURE_ID then removal will be attempted on atlas
+    RemoveTexture(); // If INVALID_TEXTURE_ID then removal will be attempted on atlas; a queued load is cancelled
     mImpl->mResourceStatus = Toolkit::Visual::ResourceStatus::PREPARING;
   }
+  else
+  {
+    // The texture is kept, but images of visuals on stage are loaded first
+    SetTexturePriority( DevelAsyncImageLoader::LoadPriority::BACKGROUND );
+  }
 
   if( mImageUrl.IsValid() )
   {
@@ -1010,10 +1021,21 @@ void ImageVisual::UploadComplete( bool loadingSuccess, int32_t textureId, Textur
   mLoading = false;
 }
 
+void ImageVisual::SetTexturePriority( DevelAsyncImageLoader::LoadPriority priority )
+{
+  if( ( mTextureId != TextureManager::INVALID_TEXTURE_ID ) && ( mLoadPriority != priority ) )
+  {
+    mFactoryCache.GetTextureManager().SetTexturePriority( mTextureId, mLoadPriority, priority );
+    mLoadPriority = priority;
+  }
+}
+
 void ImageVisual::RemoveTexture()
 {
   if( mTextureId != TextureManager::INVALID_TEXTURE_ID )
   {
+    // A user needs the texture VISIBLE when it is added or removed
+    SetTexturePriority( DevelAsyncImageLoader::LoadPriority::VISIBLE );
     mFactoryCache.GetTextureManager().Remove( mTextureId );
     mTextureId = TextureManager::INVALID_TEXTURE_ID;
   }
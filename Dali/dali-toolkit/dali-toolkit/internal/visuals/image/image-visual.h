@@ -28,6 +28,7 @@
 #include <dali/public-api/object/weak-handle.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
 #include <dali-toolkit/devel-api/image-loader/atlas-upload-observer.h>
 #include <dali-toolkit/internal/visuals/texture-upload-observer.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
@@ -344,6 +345,12 @@ private:
    */
   void SetTextureRectUniform( const Vector4& textureRect  );
 
+  /**
+   * Set the load priority this visual needs for the texture, if it has a valid TextureId
+   * @param[in] priority The priority of the load
+   */
+  void SetTexturePriority( DevelAsyncImageLoader::LoadPriority priority );
+
   /**
    * Remove texture with valid TextureId
    */
@@ -367,6 +374,7 @@ private:
   Dali::ImageDimensions mDesiredSize;
   TextureManager::TextureId mTextureId;
   TextureSet mTextures;
+  DevelAsyncImageLoader::LoadPriority mLoadPriority; ///< The load priority this visual needs for the texture
 
   ImageVisualShaderFactory& mImageVisualShaderFactory;
 
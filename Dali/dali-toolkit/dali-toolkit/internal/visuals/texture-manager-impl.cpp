@@ -19,8 +19,10 @@
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
 // EXTERNAL HEADERS
+#include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <dali/public-api/images/pixel.h>
 #include <dali/public-api/math/vector4.h>
 #include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -125,13 +127,20 @@ TextureManager::MaskingData::MaskingData()
 }
 
 TextureManager::TextureManager()
-: mAsyncLocalLoaders( GetNumberOfLocalLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
+: mTextureInfoContainer(),
+  mTextureHashes(),
+  mTextureCacheIndices(),
+  mFreeCacheIndices(),
+  mAsyncLocalLoaders( GetNumberOfLocalLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
   mAsyncRemoteLoaders( GetNumberOfRemoteLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
   mExternalTextures(),
   mLifecycleObservers(),
   mLoadQueue(),
   mBrokenImageUrl(""),
   mCurrentTextureId( 0 ),
+  mReleasedTextures(),
+  mCacheBudget( 0u ),
+  mCacheStatistics(),
   mQueueLoadFlag(false)
 {
 }
@@ -357,14 +366,34 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   int cacheIndex = FindCachedTexture( textureHash, url.GetUrl(), desiredSize, fittingMode, samplingMode, useAtlas,
                                       maskTextureId, preMultiplyOnLoad );
 
+  ++mCacheStatistics.requestCount;
+
   // Check if the requested Texture exists in the cache.
   if( cacheIndex != INVALID_CACHE_INDEX )
   {
-    if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
+    TextureInfo& cachedTextureInfo( mTextureInfoContainer[ cacheIndex ] );
+    if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy || cachedTextureInfo.released )
     {
       // Mark this texture being used by another client resource. Forced reload would replace the current texture
-      // without the need for incrementing the reference count.
-      ++( mTextureInfoContainer[ cacheIndex ].referenceCount );
+      // without the need for incrementing the reference count, unless the texture has no user since it was released.
+      ++cachedTextureInfo.referenceCount;
+
+      // The new user needs the Texture to be VISIBLE
+      UpdateLoadPriority( cachedTextureInfo );
+    }
+    if( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
+    {
+      ++mCacheStatistics.hitCount;
+      if( cachedTextureInfo.released )
+      {
+        ++mCacheStatistics.releasedHitCount;
+      }
+    }
+    if( cachedTextureInfo.released )
+    {
+      mReleasedTextures.erase( cachedTextureInfo.releasedPosition );
+      mCacheStatistics.releasedSize -= cachedTextureInfo.textureSize;
+      cachedTextureInfo.released = false;
     }
     textureId = mTextureInfoContainer[ cacheIndex ].textureId;
 
@@ -380,11 +409,10 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
     // We need a new Texture.
     textureId = GenerateUniqueTextureId();
     bool preMultiply = ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD );
-    mTextureInfoContainer.push_back( TextureInfo( textureId, maskTextureId, url.GetUrl(),
-                                                  desiredSize, contentScale, fittingMode, samplingMode,
-                                                  false, cropToMask, useAtlas, textureHash, orientationCorrection,
-                                                  preMultiply ) );
-    cacheIndex = mTextureInfoContainer.size() - 1u;
+    cacheIndex = AddTextureInfo( TextureInfo( textureId, maskTextureId, url.GetUrl(),
+                                              desiredSize, contentScale, fittingMode, samplingMode,
+                                              false, cropToMask, useAtlas, textureHash, orientationCorrection,
+                                              preMultiply ) );
 
     DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::RequestLoad( url=%s observer=%p ) New texture, cacheIndex:%d, textureId=%d\n",
                    url.GetUrl().c_str(), observer, cacheIndex, textureId );
@@ -474,22 +502,36 @@ void TextureManager::Remove( const TextureManager::TextureId textureId )
     {
       // This is the last remove for this Texture.
       textureInfo.referenceCount = 0;
+      textureInfo.prefetchUserCount = 0;
+      textureInfo.backgroundUserCount = 0;
       bool removeTextureInfo = false;
 
-      // If loaded, we can remove the TextureInfo and the Atlas (if atlased).
+      // If loaded, we can remove the TextureInfo and the Atlas (if atlased), unless the Texture is kept cached.
       if( textureInfo.loadState == UPLOADED )
       {
         if( textureInfo.atlas )
         {
           textureInfo.atlas.Remove( textureInfo.atlasRect );
+          removeTextureInfo = true;
+        }
+        else
+        {
+          removeTextureInfo = !ReleaseTexture( textureInfoIndex );
         }
-        removeTextureInfo = true;
       }
       else if( textureInfo.loadState == LOADING )
       {
-        // We mark the textureInfo for removal.
-        // Once the load has completed, this method will be called again.
-        textureInfo.loadState = CANCELLED;
+        if( CancelLoad( textureInfo ) )
+        {
+          // The load had not started, so nothing will complete.
+          removeTextureInfo = true;
+        }
+        else
+        {
+          // We mark the textureInfo for removal.
+          // Once the load has completed, this method will be called again.
+          textureInfo.loadState = CANCELLED;
+        }
       }
       else
       {
@@ -501,7 +543,74 @@ void TextureManager::Remove( const TextureManager::TextureId textureId )
       if( removeTextureInfo )
       {
         // Permanently remove the textureInfo struct.
-        mTextureInfoContainer.erase( mTextureInfoContainer.begin() + textureInfoIndex );
+        RemoveTextureInfo( textureInfoIndex );
+      }
+    }
+    else
+    {
+      // The remaining users may not need the Texture as soon
+      UpdateLoadPriority( textureInfo );
+    }
+  }
+}
+
+void TextureManager::SetTexturePriority( TextureId textureId,
+                                         DevelAsyncImageLoader::LoadPriority previousPriority,
+                                         DevelAsyncImageLoader::LoadPriority priority )
+{
+  int cacheIndex = GetCacheIndexFromId( textureId );
+  if( ( cacheIndex != INVALID_CACHE_INDEX ) && ( previousPriority != priority ) )
+  {
+    TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
+
+    if( previousPriority == DevelAsyncImageLoader::LoadPriority::PREFETCH )
+    {
+      --textureInfo.prefetchUserCount;
+    }
+    else if( previousPriority == DevelAsyncImageLoader::LoadPriority::BACKGROUND )
+    {
+      --textureInfo.backgroundUserCount;
+    }
+
+    if( priority == DevelAsyncImageLoader::LoadPriority::PREFETCH )
+    {
+      ++textureInfo.prefetchUserCount;
+    }
+    else if( priority == DevelAsyncImageLoader::LoadPriority::BACKGROUND )
+    {
+      ++textureInfo.backgroundUserCount;
+    }
+
+    UpdateLoadPriority( textureInfo );
+  }
+}
+
+void TextureManager::UpdateLoadPriority( TextureInfo& textureInfo )
+{
+  // The Texture is loaded with the highest priority needed by any of its users
+  DevelAsyncImageLoader::LoadPriority loadPriority = DevelAsyncImageLoader::LoadPriority::VISIBLE;
+  if( ( textureInfo.referenceCount > 0 ) &&
+      ( textureInfo.referenceCount <= textureInfo.prefetchUserCount + textureInfo.backgroundUserCount ) )
+  {
+    loadPriority = ( textureInfo.prefetchUserCount > 0 ) ? DevelAsyncImageLoader::LoadPriority::PREFETCH
+                                                         : DevelAsyncImageLoader::LoadPriority::BACKGROUND;
+  }
+
+  if( textureInfo.loadPriority != loadPriority )
+  {
+    DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::UpdateLoadPriority( textureId:%d priority:%d ) loadState:%s\n",
+                   textureInfo.textureId, static_cast<int>( loadPriority ), GET_LOAD_STATE_STRING( textureInfo.loadState ) );
+
+    textureInfo.loadPriority = loadPriority;
+    if( textureInfo.loadState == LOADING || textureInfo.loadState == MASK_APPLYING )
+    {
+      auto& loadersContainer = textureInfo.url.IsLocalResource() ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
+      for( auto iter = loadersContainer.Begin(); iter != loadersContainer.End(); ++iter )
+      {
+        if( iter->SetPriority( textureInfo.textureId, loadPriority ) )
+        {
+          break;
+        }
       }
     }
   }
@@ -713,7 +822,7 @@ void TextureManager::LoadTexture( TextureInfo& textureInfo, TextureUploadObserve
     loadingHelperIt->Load(textureInfo.textureId, textureInfo.url,
                           textureInfo.desiredSize, textureInfo.fittingMode,
                           textureInfo.samplingMode, textureInfo.orientationCorrection,
-                          premultiplyOnLoad );
+                          premultiplyOnLoad, textureInfo.loadPriority );
   }
   ObserveTexture( textureInfo, observer );
 }
@@ -759,34 +868,34 @@ void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingCo
 {
   DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::AsyncLoadComplete( id:%d )\n", id );
 
-  if( loadingContainer.size() >= 1u )
+  // Tasks of a higher priority complete first, so the task is not necessarily the oldest one.
+  auto loadingIter = std::find_if( loadingContainer.begin(), loadingContainer.end(),
+                                   [id]( const AsyncLoadingInfo& info ) { return info.loadId == id; } );
+  if( loadingIter != loadingContainer.end() )
   {
-    AsyncLoadingInfo loadingInfo = loadingContainer.front();
+    // Erase the task first, as the loading container may be modified while processing the texture.
+    AsyncLoadingInfo loadingInfo = *loadingIter;
+    loadingContainer.erase( loadingIter );
 
-    if( loadingInfo.loadId == id )
+    int cacheIndex = GetCacheIndexFromId( loadingInfo.textureId );
+    if( cacheIndex != INVALID_CACHE_INDEX )
     {
-      int cacheIndex = GetCacheIndexFromId( loadingInfo.textureId );
-      if( cacheIndex != INVALID_CACHE_INDEX )
-      {
-        TextureInfo& textureInfo( mTextureInfoContainer[cacheIndex] );
+      TextureInfo& textureInfo( mTextureInfoContainer[cacheIndex] );
 
-        DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise,
-                       "  textureId:%d Url:%s CacheIndex:%d LoadState: %d\n",
-                       textureInfo.textureId, textureInfo.url.GetUrl().c_str(), cacheIndex, textureInfo.loadState );
+      DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise,
+                     "  textureId:%d Url:%s CacheIndex:%d LoadState: %d\n",
+                     textureInfo.textureId, textureInfo.url.GetUrl().c_str(), cacheIndex, textureInfo.loadState );
 
-        if( textureInfo.loadState != CANCELLED )
-        {
-          // textureInfo can be invalidated after this call (as the mTextureInfoContainer may be modified)
-          PostLoad( textureInfo, pixelBuffer );
-        }
-        else
-        {
-          Remove( textureInfo.textureId );
-        }
+      if( textureInfo.loadState != CANCELLED )
+      {
+        // textureInfo can be invalidated after this call (as the mTextureInfoContainer may be modified)
+        PostLoad( textureInfo, pixelBuffer );
+      }
+      else
+      {
+        Remove( textureInfo.textureId );
       }
     }
-
-    loadingContainer.pop_front();
   }
 }
 
@@ -896,7 +1005,8 @@ void TextureManager::ApplyMask( TextureInfo& textureInfo, TextureId maskTextureI
     auto loadingHelperIt = loadersContainer.GetNext();
     auto premultiplyOnLoad = textureInfo.preMultiplyOnLoad ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF;
     DALI_ASSERT_ALWAYS(loadingHelperIt != loadersContainer.End());
-    loadingHelperIt->ApplyMask( textureInfo.textureId, pixelBuffer, maskPixelBuffer, textureInfo.scaleFactor, textureInfo.cropToMask, premultiplyOnLoad );
+    loadingHelperIt->ApplyMask( textureInfo.textureId, pixelBuffer, maskPixelBuffer, textureInfo.scaleFactor, textureInfo.cropToMask, premultiplyOnLoad,
+                                textureInfo.loadPriority );
   }
 }
 
@@ -919,6 +1029,11 @@ void TextureManager::UploadTexture( Devel::PixelBuffer& pixelBuffer, TextureInfo
       textureInfo.textureSet = TextureSet::New();
     }
     textureInfo.textureSet.SetTexture( 0u, texture );
+
+    mCacheStatistics.residentSize -= textureInfo.textureSize;
+    textureInfo.textureSize = pixelBuffer.GetWidth() * pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel( pixelBuffer.GetPixelFormat() );
+    mCacheStatistics.residentSize += textureInfo.textureSize;
+    EvictReleasedTextures();
   }
 
   // Update the load state.
@@ -987,17 +1102,120 @@ TextureManager::TextureId TextureManager::GenerateUniqueTextureId()
 
 int TextureManager::GetCacheIndexFromId( const TextureId textureId )
 {
-  const unsigned int size = mTextureInfoContainer.size();
+  const auto iter = mTextureCacheIndices.find( textureId );
+  if( iter != mTextureCacheIndices.end() )
+  {
+    return iter->second;
+  }
+
+  return INVALID_CACHE_INDEX;
+}
+
+int TextureManager::AddTextureInfo( TextureInfo&& textureInfo )
+{
+  int cacheIndex;
+  if( !mFreeCacheIndices.empty() )
+  {
+    cacheIndex = mFreeCacheIndices.back();
+    mFreeCacheIndices.pop_back();
+    mTextureInfoContainer[ cacheIndex ] = std::move( textureInfo );
+  }
+  else
+  {
+    cacheIndex = static_cast<int>( mTextureInfoContainer.size() );
+    mTextureInfoContainer.push_back( std::move( textureInfo ) );
+  }
+
+  const TextureInfo& addedTextureInfo( mTextureInfoContainer[ cacheIndex ] );
+  mTextureHashes.insert( std::make_pair( addedTextureInfo.hash, cacheIndex ) );
+  mTextureCacheIndices[ addedTextureInfo.textureId ] = cacheIndex;
+
+  return cacheIndex;
+}
+
+void TextureManager::RemoveTextureInfo( int cacheIndex )
+{
+  TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
 
-  for( unsigned int i = 0; i < size; ++i )
+  auto range = mTextureHashes.equal_range( textureInfo.hash );
+  for( auto iter = range.first; iter != range.second; ++iter )
   {
-    if( mTextureInfoContainer[i].textureId == textureId )
+    if( iter->second == cacheIndex )
     {
-      return i;
+      mTextureHashes.erase( iter );
+      break;
     }
   }
+  mTextureCacheIndices.erase( textureInfo.textureId );
+  mCacheStatistics.residentSize -= textureInfo.textureSize;
+
+  // Release the resources held by the slot; an empty slot has no observers and is never waiting for a mask.
+  textureInfo = TextureInfo( INVALID_TEXTURE_ID, INVALID_TEXTURE_ID, VisualUrl(), ImageDimensions(), 1.0f,
+                             FittingMode::DEFAULT, SamplingMode::DEFAULT, false, false, NO_ATLAS, 0u, false, false );
+  textureInfo.referenceCount = 0;
+  mFreeCacheIndices.push_back( cacheIndex );
+}
 
-  return INVALID_CACHE_INDEX;
+bool TextureManager::CancelLoad( TextureInfo& textureInfo )
+{
+  auto& loadersContainer = textureInfo.url.IsLocalResource() ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
+  for( auto iter = loadersContainer.Begin(); iter != loadersContainer.End(); ++iter )
+  {
+    if( iter->Cancel( textureInfo.textureId ) )
+    {
+      DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::CancelLoad() Cancelled textureId:%d\n", textureInfo.textureId );
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TextureManager::ReleaseTexture( int cacheIndex )
+{
+  TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
+  if( textureInfo.released )
+  {
+    // Removed once more than requested; it is already kept.
+    return true;
+  }
+
+  // A masked Texture is not kept, as its mask is removed and a new mask would not match its hash.
+  if( mCacheBudget == 0u ||
+      !textureInfo.textureSet ||
+      textureInfo.storageType != UPLOAD_TO_TEXTURE ||
+      textureInfo.maskTextureId != INVALID_TEXTURE_ID )
+  {
+    return false;
+  }
+
+  DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::ReleaseTexture() Keeping textureId:%d size:%u\n",
+                 textureInfo.textureId, textureInfo.textureSize );
+
+  textureInfo.released = true;
+  textureInfo.releasedPosition = mReleasedTextures.insert( mReleasedTextures.begin(), cacheIndex );
+  mCacheStatistics.releasedSize += textureInfo.textureSize;
+
+  EvictReleasedTextures();
+  return true;
+}
+
+void TextureManager::EvictReleasedTextures()
+{
+  while( mCacheStatistics.residentSize > mCacheBudget && !mReleasedTextures.empty() )
+  {
+    const int cacheIndex = mReleasedTextures.back();
+    mReleasedTextures.pop_back();
+
+    TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
+    DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::EvictReleasedTextures() Removing textureId:%d size:%u\n",
+                   textureInfo.textureId, textureInfo.textureSize );
+
+    mCacheStatistics.releasedSize -= textureInfo.textureSize;
+    textureInfo.released = false;
+    ++mCacheStatistics.evictionCount;
+
+    RemoveTextureInfo( cacheIndex );
+  }
 }
 
 TextureManager::TextureHash TextureManager::GenerateHash(
@@ -1082,31 +1300,32 @@ int TextureManager::FindCachedTexture(
   // Default to an invalid ID, in case we do not find a match.
   int cacheIndex = INVALID_CACHE_INDEX;
 
-  // Iterate through our hashes to find a match.
-  const unsigned int count = mTextureInfoContainer.size();
-  for( unsigned int i = 0u; i < count; ++i )
+  // Look up the Textures with this hash.
+  // If several match, the oldest (with the lowest TextureId) is used, as when the cache was searched in order.
+  const auto range = mTextureHashes.equal_range( hash );
+  for( auto iter = range.first; iter != range.second; ++iter )
   {
-    if( mTextureInfoContainer[i].hash == hash )
+    // We have a match, now we check all the original parameters in case of a hash collision.
+    const int i = iter->second;
+    TextureInfo& textureInfo( mTextureInfoContainer[i] );
+
+    if( ( url == textureInfo.url.GetUrl() ) &&
+        ( useAtlas == textureInfo.useAtlas ) &&
+        ( maskTextureId == textureInfo.maskTextureId ) &&
+        ( size == textureInfo.desiredSize ) &&
+        ( ( size.GetWidth() == 0 && size.GetHeight() == 0 ) ||
+          ( fittingMode == textureInfo.fittingMode &&
+            samplingMode == textureInfo.samplingMode ) ) )
     {
-      // We have a match, now we check all the original parameters in case of a hash collision.
-      TextureInfo& textureInfo( mTextureInfoContainer[i] );
-
-      if( ( url == textureInfo.url.GetUrl() ) &&
-          ( useAtlas == textureInfo.useAtlas ) &&
-          ( maskTextureId == textureInfo.maskTextureId ) &&
-          ( size == textureInfo.desiredSize ) &&
-          ( ( size.GetWidth() == 0 && size.GetHeight() == 0 ) ||
-            ( fittingMode == textureInfo.fittingMode &&
-              samplingMode == textureInfo.samplingMode ) ) )
+      // 1. If preMultiplyOnLoad is MULTIPLY_ON_LOAD, then textureInfo.preMultiplyOnLoad should be true. The premultiplication result can be different.
+      // 2. If preMultiplyOnLoad is LOAD_WITHOUT_MULTIPLY, then textureInfo.preMultiplied should be false.
+      if( ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad )
+          || ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied ) )
       {
-        // 1. If preMultiplyOnLoad is MULTIPLY_ON_LOAD, then textureInfo.preMultiplyOnLoad should be true. The premultiplication result can be different.
-        // 2. If preMultiplyOnLoad is LOAD_WITHOUT_MULTIPLY, then textureInfo.preMultiplied should be false.
-        if( ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad )
-            || ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied ) )
+        // The found Texture is a match.
+        if( cacheIndex == INVALID_CACHE_INDEX || textureInfo.textureId < mTextureInfoContainer[ cacheIndex ].textureId )
         {
-          // The found Texture is a match.
           cacheIndex = i;
-          break;
         }
       }
     }
@@ -1149,10 +1368,11 @@ void TextureManager::AsyncLoadingHelper::Load(TextureId          textureId,
                                               FittingMode::Type  fittingMode,
                                               SamplingMode::Type samplingMode,
                                               bool               orientationCorrection,
-                                              DevelAsyncImageLoader::PreMultiplyOnLoad  preMultiplyOnLoad)
+                                              DevelAsyncImageLoader::PreMultiplyOnLoad  preMultiplyOnLoad,
+                                              DevelAsyncImageLoader::LoadPriority priority)
 {
   mLoadingInfoContainer.push_back(AsyncLoadingInfo(textureId));
-  auto id = DevelAsyncImageLoader::Load( mLoader, url.GetUrl(), desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad );
+  auto id = DevelAsyncImageLoader::Load( mLoader, url.GetUrl(), desiredSize, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad, priority );
   mLoadingInfoContainer.back().loadId = id;
 }
 
@@ -1161,13 +1381,38 @@ void TextureManager::AsyncLoadingHelper::ApplyMask( TextureId textureId,
                                                     Devel::PixelBuffer maskPixelBuffer,
                                                     float contentScale,
                                                     bool cropToMask,
-                                                    DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad )
+                                                    DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                                                    DevelAsyncImageLoader::LoadPriority priority )
 {
   mLoadingInfoContainer.push_back(AsyncLoadingInfo(textureId));
-  auto id = DevelAsyncImageLoader::ApplyMask( mLoader, pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad );
+  auto id = GetImplementation( mLoader ).ApplyMask( pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad, priority );
   mLoadingInfoContainer.back().loadId = id;
 }
 
+bool TextureManager::AsyncLoadingHelper::Cancel( TextureId textureId )
+{
+  auto iter = std::find_if( mLoadingInfoContainer.begin(), mLoadingInfoContainer.end(),
+                            [textureId]( const AsyncLoadingInfo& info ) { return info.textureId == textureId; } );
+  if( iter != mLoadingInfoContainer.end() && mLoader.Cancel( iter->loadId ) )
+  {
+    mLoadingInfoContainer.erase( iter );
+    return true;
+  }
+  return false;
+}
+
+bool TextureManager::AsyncLoadingHelper::SetPriority( TextureId textureId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  auto iter = std::find_if( mLoadingInfoContainer.begin(), mLoadingInfoContainer.end(),
+                            [textureId]( const AsyncLoadingInfo& info ) { return info.textureId == textureId; } );
+  if( iter != mLoadingInfoContainer.end() )
+  {
+    DevelAsyncImageLoader::SetPriority( mLoader, iter->loadId, priority );
+    return true;
+  }
+  return false;
+}
+
 TextureManager::AsyncLoadingHelper::AsyncLoadingHelper(AsyncLoadingHelper&& rhs)
 : AsyncLoadingHelper(rhs.mLoader, rhs.mTextureManager, std::move(rhs.mLoadingInfoContainer))
 {
@@ -1196,6 +1441,22 @@ void TextureManager::SetBrokenImageUrl(const std::string& brokenImageUrl)
   mBrokenImageUrl = brokenImageUrl;
 }
 
+void TextureManager::SetCacheBudget( uint64_t budget )
+{
+  mCacheBudget = budget;
+  EvictReleasedTextures();
+}
+
+uint64_t TextureManager::GetCacheBudget() const
+{
+  return mCacheBudget;
+}
+
+Toolkit::TextureManager::CacheStatistics TextureManager::GetCacheStatistics() const
+{
+  return mCacheStatistics;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
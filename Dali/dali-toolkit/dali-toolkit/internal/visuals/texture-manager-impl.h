@@ -20,8 +20,11 @@
 // EXTERNAL INCLUDES
 #include <deque>
 #include <functional>
+#include <list>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
@@ -31,6 +34,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
 #include <dali-toolkit/devel-api/image-loader/image-atlas.h>
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali-toolkit/public-api/image-loader/async-image-loader.h>
 #include <dali-toolkit/internal/visuals/texture-upload-observer.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
@@ -312,6 +316,21 @@ public:
    */
   void Remove( const TextureManager::TextureId textureId );
 
+  /**
+   * @brief Change the load priority needed by one of the users of a Texture.
+   *
+   * A user needs the VISIBLE priority when it starts using a Texture, and must set it back before removing the Texture.
+   * If the Texture is still waiting to be loaded, it is loaded with the highest priority needed by any of its users,
+   * before the Textures of a lower priority.
+   *
+   * @param[in] textureId The ID of the Texture
+   * @param[in] previousPriority The priority needed by the user until now
+   * @param[in] priority The priority needed by the user from now on
+   */
+  void SetTexturePriority( TextureId textureId,
+                           DevelAsyncImageLoader::LoadPriority previousPriority,
+                           DevelAsyncImageLoader::LoadPriority priority );
+
   /**
    * @brief Get the visualUrl associated with the texture id.
    * @param[in] textureId The texture Id to get
@@ -367,6 +386,24 @@ public:
    */
   void SetBrokenImageUrl(const std::string& brokenImageUrl);
 
+  /**
+   * @brief Set the GPU memory budget of the released textures kept cached
+   * @param[in] budget The budget in bytes, or 0 to delete the textures as soon as they are released
+   */
+  void SetCacheBudget( uint64_t budget );
+
+  /**
+   * @brief Get the GPU memory budget of the released textures kept cached
+   * @return The budget in bytes
+   */
+  uint64_t GetCacheBudget() const;
+
+  /**
+   * @brief Get the statistics of the texture cache
+   * @return The statistics
+   */
+  Toolkit::TextureManager::CacheStatistics GetCacheStatistics() const;
+
 private:
 
   /**
@@ -425,6 +462,7 @@ private:
   LoadState GetTextureStateInternal( TextureId textureId );
 
   typedef size_t TextureHash; ///< The type used to store the hash used for Texture caching.
+  typedef std::list< int > ReleasedTextureContainerType; ///< The container type used to order the released Textures, most recently released first
 
   // Structs:
 
@@ -455,6 +493,11 @@ private:
       hash( hash ),
       scaleFactor( scaleFactor ),
       referenceCount( 1u ),
+      textureSize( 0u ),
+      releasedPosition(),
+      prefetchUserCount( 0 ),
+      backgroundUserCount( 0 ),
+      loadPriority( DevelAsyncImageLoader::LoadPriority::VISIBLE ),
       loadState( NOT_STARTED ),
       fittingMode( fittingMode ),
       samplingMode( samplingMode ),
@@ -464,7 +507,8 @@ private:
       cropToMask( cropToMask ),
       orientationCorrection( true ),
       preMultiplyOnLoad( preMultiplyOnLoad ),
-      preMultiplied( false )
+      preMultiplied( false ),
+      released( false )
     {
     }
 
@@ -486,6 +530,11 @@ private:
     TextureManager::TextureHash hash; ///< The hash used to cache this Texture
     float scaleFactor;             ///< The scale factor to apply to the Texture when masking
     int16_t referenceCount;        ///< The reference count of clients using this Texture
+    uint32_t textureSize;          ///< The size in bytes of the uploaded Texture, 0 if atlased or not uploaded
+    ReleasedTextureContainerType::iterator releasedPosition; ///< The position in the released Textures, if released
+    int16_t prefetchUserCount;     ///< The number of users needing the PREFETCH priority; the other users need it VISIBLE
+    int16_t backgroundUserCount;   ///< The number of users needing the BACKGROUND priority; the other users need it VISIBLE
+    DevelAsyncImageLoader::LoadPriority loadPriority; ///< The priority of the asynchronous load of the Texture
     LoadState loadState:4;         ///< The load state showing the load progress of the Texture
     FittingMode::Type fittingMode:2; ///< The requested FittingMode
     Dali::SamplingMode::Type samplingMode:3; ///< The requested SamplingMode
@@ -497,6 +546,7 @@ private:
     bool orientationCorrection:1;  ///< true if the image should be rotated to match exif orientation data
     bool preMultiplyOnLoad:1;      ///< true if the image's color should be multiplied by it's alpha
     bool preMultiplied:1;          ///< true if the image's color was multiplied by it's alpha
+    bool released:1;               ///< true if the Texture has no user, but is kept cached within the budget
   };
 
   /**
@@ -534,6 +584,8 @@ private:
 
   typedef std::deque<AsyncLoadingInfo>  AsyncLoadingInfoContainerType;  ///< The container type used to manage Asynchronous loads in progress
   typedef std::vector<TextureInfo>      TextureInfoContainerType;       ///< The container type used to manage the life-cycle and caching of Textures
+  typedef std::unordered_multimap<TextureHash, int> TextureHashContainerType; ///< The container type used to look up the cache indices of Textures by hash
+  typedef std::unordered_map<TextureId, int> TextureIdContainerType;    ///< The container type used to look up the cache indices of Textures by TextureId
 
   /**
    * @brief Initiate a load or queue load if NotifyObservers is invoking callbacks
@@ -647,6 +699,45 @@ private:
    */
   int GetCacheIndexFromId( TextureId textureId );
 
+  /**
+   * @brief Adds a TextureInfo to the cache, reusing the slot of a removed one if possible.
+   * @param[in] textureInfo The TextureInfo to add
+   * @return The cache index of the TextureInfo
+   */
+  int AddTextureInfo( TextureInfo&& textureInfo );
+
+  /**
+   * @brief Removes a TextureInfo from the cache.
+   * The slot is kept so the cache indices of the other Textures do not change, and is reused by a later Texture.
+   * @param[in] cacheIndex The cache index of the TextureInfo
+   */
+  void RemoveTextureInfo( int cacheIndex );
+
+  /**
+   * @brief Cancels the asynchronous load of a Texture, if it has not started yet.
+   * @param[in] textureInfo The TextureInfo struct associated with the Texture
+   * @return true if the load is cancelled, false if it has started or is not asynchronous
+   */
+  bool CancelLoad( TextureInfo& textureInfo );
+
+  /**
+   * @brief Sets the load priority of a Texture to the highest priority needed by any of its users.
+   * If the Texture is still waiting to be loaded, the priority of the load is changed too.
+   * @param[in] textureInfo The TextureInfo struct associated with the Texture
+   */
+  void UpdateLoadPriority( TextureInfo& textureInfo );
+
+  /**
+   * @brief Keeps an uploaded Texture cached after its last user released it, if the budget allows it.
+   * @param[in] cacheIndex The cache index of the TextureInfo
+   * @return true if the Texture is kept, false if the TextureInfo has to be removed
+   */
+  bool ReleaseTexture( int cacheIndex );
+
+  /**
+   * @brief Removes the least recently released Textures until the uploaded Textures fit within the budget.
+   */
+  void EvictReleasedTextures();
 
   /**
    * @brief Generates a hash for caching based on the input parameters.
@@ -713,6 +804,7 @@ private:
      * @param[in] orientationCorrection Whether to use image metadata to rotate or flip the image,
      *                                  e.g., from portrait to landscape
      * @param[in] preMultiplyOnLoad     if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha or if the image need to be applied alpha mask.
+     * @param[in] priority              The priority of the task
      */
     void Load(TextureId textureId,
               const VisualUrl& url,
@@ -720,7 +812,8 @@ private:
               FittingMode::Type fittingMode,
               SamplingMode::Type samplingMode,
               bool orientationCorrection,
-              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
+              DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+              DevelAsyncImageLoader::LoadPriority priority);
 
     /**
      * @brief Apply mask
@@ -730,13 +823,30 @@ private:
      * @param [in] contentScale The factor to scale the content
      * @param [in] cropToMask Whether to crop the content to the mask size
      * @param [in] preMultiplyOnLoad if the image's color should be multiplied by it's alpha. Set to OFF if there is no alpha.
+     * @param [in] priority The priority of the task
      */
     void ApplyMask( TextureId textureId,
                     Devel::PixelBuffer pixelBuffer,
                     Devel::PixelBuffer maskPixelBuffer,
                     float contentScale,
                     bool cropToMask,
-                    DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
+                    DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad,
+                    DevelAsyncImageLoader::LoadPriority priority );
+
+    /**
+     * @brief Cancel the task of a texture, if it has not started yet.
+     * @param[in] textureId TextureId of the task
+     * @return true if the task is cancelled
+     */
+    bool Cancel( TextureId textureId );
+
+    /**
+     * @brief Change the priority of the task of a texture, if it has not started yet.
+     * @param[in] textureId TextureId of the task
+     * @param[in] priority  The new priority of the task
+     * @return true if the task is found in this loader
+     */
+    bool SetPriority( TextureId textureId, DevelAsyncImageLoader::LoadPriority priority );
 
   public:
     AsyncLoadingHelper(const AsyncLoadingHelper&) = delete;
@@ -794,6 +904,9 @@ private:
 private:  // Member Variables:
 
   TextureInfoContainerType                      mTextureInfoContainer; ///< Used to manage the life-cycle and caching of Textures
+  TextureHashContainerType                      mTextureHashes;        ///< The cache indices of the Textures by hash
+  TextureIdContainerType                        mTextureCacheIndices;  ///< The cache indices of the Textures by TextureId
+  std::vector< int >                            mFreeCacheIndices;     ///< The cache indices of removed Textures, which are reused first
   RoundRobinContainerView< AsyncLoadingHelper > mAsyncLocalLoaders;    ///< The Asynchronous image loaders used to provide all local async loads
   RoundRobinContainerView< AsyncLoadingHelper > mAsyncRemoteLoaders;   ///< The Asynchronous image loaders used to provide all remote async loads
   std::vector< ExternalTextureInfo >            mExternalTextures;     ///< Externally provided textures
@@ -801,6 +914,9 @@ private:  // Member Variables:
   Dali::Vector<LoadQueueElement>                mLoadQueue;            ///< Queue of textures to load after NotifyObservers
   std::string                                   mBrokenImageUrl;       ///< Broken image url
   TextureId                                     mCurrentTextureId;     ///< The current value used for the unique Texture Id generation
+  ReleasedTextureContainerType                  mReleasedTextures;     ///< The cache indices of the released Textures, most recently released first
+  uint64_t                                      mCacheBudget;          ///< The size in bytes the uploaded Textures may reach before released ones are removed
+  Toolkit::TextureManager::CacheStatistics      mCacheStatistics;      ///< The statistics of the cache
   bool                                          mQueueLoadFlag;        ///< Flag that causes Load Textures to be queued.
 };
 